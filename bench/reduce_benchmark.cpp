@@ -0,0 +1,144 @@
+#include <glow/reduce.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+namespace {
+
+constexpr std::size_t sample_count{ std::size_t{ 1 } << 24 };
+
+constexpr int repeats{ 20 };
+
+const glow::simd_level levels[]{
+  glow::simd_level::scalar, glow::simd_level::sse2,         glow::simd_level::avx2,
+  glow::simd_level::avx512, glow::simd_level::neon,         glow::simd_level::wasm_simd128,
+};
+
+/// @brief Runs a reduction a few times, returning the best time in seconds along with the last result.
+template<typename Func>
+auto
+measure(Func func, double& result) -> double
+{
+  auto best = 1e30;
+
+  for (int i = 0; i < repeats; i++) {
+    const auto start = std::chrono::steady_clock::now();
+    result = func();
+    const auto stop = std::chrono::steady_clock::now();
+    best = std::min(best, std::chrono::duration<double>(stop - start).count());
+  }
+
+  return best;
+}
+
+/// @brief Checks a result against the scalar one. The vector kernels add in a different order, so the means may differ
+///        in the last few digits.
+auto
+matches(const double result, const double expected) -> bool
+{
+  return std::fabs(result - expected) <= (1e-9 * std::max(std::fabs(expected), 1.0));
+}
+
+template<typename T>
+auto
+run(const char* type_name, const std::vector<T>& values) -> bool
+{
+  const auto bytes = static_cast<double>(values.size() * sizeof(T));
+
+  double scalar_min_max{};
+  double scalar_mean{};
+  double expected_min_max{};
+  double expected_mean{};
+
+  auto ok = true;
+
+  for (const auto level : levels) {
+
+    if (!glow::is_simd_level_supported(level)) {
+      continue;
+    }
+
+    glow::set_simd_level(level);
+
+    double min_max{};
+    const auto min_max_time = measure(
+      [&] {
+        const auto r = glow::reduce_min_max(values.data(), values.size());
+        return r.max - r.min;
+      },
+      min_max);
+
+    double mean{};
+    const auto mean_time = measure([&] { return glow::reduce_mean(values.data(), values.size()); }, mean);
+
+    if (level == glow::simd_level::scalar) {
+      scalar_min_max = min_max_time;
+      scalar_mean = mean_time;
+      expected_min_max = min_max;
+      expected_mean = mean;
+    }
+
+    const auto correct = matches(min_max, expected_min_max) && matches(mean, expected_mean);
+    ok = ok && correct;
+
+    std::printf("%-8s %-18s min/max %7.2f GB/s (%5.2fx)   mean %7.2f GB/s (%5.2fx)%s\n",
+                type_name,
+                glow::get_simd_level_name(level),
+                bytes / min_max_time * 1e-9,
+                scalar_min_max / min_max_time,
+                bytes / mean_time * 1e-9,
+                scalar_mean / mean_time,
+                correct ? "" : "   MISMATCH");
+  }
+
+  return ok;
+}
+
+} // namespace
+
+auto
+main() -> int
+{
+  const auto best = glow::get_simd_level();
+
+  std::mt19937 rng(1234);
+  std::normal_distribution<double> dist(0.0, 1000.0);
+
+  std::vector<double> f64(sample_count);
+  for (auto& v : f64) {
+    v = dist(rng);
+  }
+
+  // A few NaN values, as left by gaps in a recording.
+  for (std::size_t i = 0; i < sample_count; i += 100003) {
+    f64[i] = std::nan("");
+  }
+
+  std::vector<float> f32(sample_count);
+  std::vector<std::int16_t> i16(sample_count);
+  for (std::size_t i = 0; i < sample_count; i++) {
+    f32[i] = static_cast<float>(f64[i]);
+    i16[i] = static_cast<std::int16_t>(std::isnan(f64[i]) ? 0.0 : std::clamp(f64[i], -32768.0, 32767.0));
+  }
+
+  std::printf("%zu values, best of %d runs, picked %s by default\n\n",
+              sample_count,
+              repeats,
+              glow::get_simd_level_name(best));
+
+  auto ok = true;
+  ok = run("float32", f32) && ok;
+  ok = run("float64", f64) && ok;
+  ok = run("int16", i16) && ok;
+
+  glow::set_simd_level(best);
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
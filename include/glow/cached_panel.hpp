@@ -0,0 +1,95 @@
+#pragma once
+
+#include <glow/framebuffer.hpp>
+
+#include <imgui.h>
+
+#include <memory>
+
+#include <cstdint>
+
+namespace glow {
+
+/// @brief A child window whose contents are rendered into a texture and reused until they change.
+///
+/// @details This is meant for panels that contain a large number of widgets or plot primitives, but that rarely
+///          change. While the panel is cached, the widgets are not submitted at all and the texture is drawn with
+///          @c ImGui::Image instead. The widgets are submitted again (and the texture refreshed) when:
+///
+///          - @ref cached_panel::invalidate is called
+///          - the state key passed to @ref cached_panel::begin changes
+///          - the panel is resized
+///          - the mouse hovers the panel, or the panel has keyboard focus, so that it stays interactive
+///
+///          Usage:
+///
+///          @code
+///          if (panel.begin("Stats", ImVec2(0, 0), data_version)) {
+///            // submit widgets
+///          }
+///          panel.end();
+///          @endcode
+///
+/// @note Only the draw list of the panel itself is captured. Popups, tooltips and nested child windows are drawn
+///       normally while the panel is live, but are not part of the cached texture.
+class cached_panel final
+{
+public:
+  cached_panel();
+
+  cached_panel(const cached_panel&) = delete;
+
+  cached_panel(cached_panel&&) = delete;
+
+  auto operator=(const cached_panel&) -> cached_panel& = delete;
+
+  auto operator=(cached_panel&&) -> cached_panel& = delete;
+
+  ~cached_panel();
+
+  /// @brief Begins the panel.
+  ///
+  /// @param id The ImGui identifier of the child window.
+  ///
+  /// @param size The size of the panel. Components that are zero or less take up the remaining content region.
+  ///
+  /// @param state_key A value that identifies the state that the contents depend on, such as a data version.
+  ///
+  /// @return True if the widgets of the panel should be submitted this frame. @ref cached_panel::end must be called
+  ///         either way.
+  auto begin(const char* id, ImVec2 size = ImVec2(0, 0), std::uint64_t state_key = 0) -> bool;
+
+  void end();
+
+  /// @brief Forces the contents to be submitted and captured again on the next frame.
+  void invalidate();
+
+  /// @brief Indicates whether the last call to @ref cached_panel::begin used the cached texture.
+  [[nodiscard]] auto is_cached() const -> bool;
+
+  /// @brief Gets the number of times the contents have been captured into the texture.
+  [[nodiscard]] auto capture_count() const -> std::uint64_t;
+
+private:
+  void capture(ImDrawList* draw_list);
+
+  std::unique_ptr<framebuffer> target_;
+
+  ImVec2 pos_{};
+
+  ImVec2 size_{};
+
+  std::uint64_t state_key_{};
+
+  std::uint64_t capture_count_{};
+
+  bool valid_{ false };
+
+  bool live_{ false };
+
+  bool capture_pending_{ false };
+
+  bool focused_{ false };
+};
+
+} // namespace glow
@@ -2,23 +2,55 @@
 
 #include <GLES3/gl3.h>
 
+#include <cstddef>
+
 namespace glow {
 
+/// @brief Describes the texture that is used as the color attachment of a framebuffer.
+struct framebuffer_format final
+{
+  GLint internal_format{ GL_RGBA };
+
+  GLenum format{ GL_RGBA };
+
+  GLenum type{ GL_UNSIGNED_BYTE };
+
+  GLint min_filter{ GL_LINEAR };
+
+  GLint mag_filter{ GL_NEAREST };
+
+  /// @brief Whether or not to attach a 24-bit depth buffer.
+  bool depth{ false };
+
+  [[nodiscard]] auto operator==(const framebuffer_format& other) const -> bool;
+
+  [[nodiscard]] auto operator!=(const framebuffer_format& other) const -> bool;
+
+  /// @brief Gets the number of bytes that a single texel of this format occupies, including the depth buffer.
+  [[nodiscard]] auto texel_size() const -> std::size_t;
+};
+
 class framebuffer final
 {
   GLuint id_{};
 
   GLuint color_attachment_{};
 
+  GLuint depth_attachment_{};
+
   GLsizei width_{};
 
   GLsizei height_{};
 
   GLenum status_{};
 
+  framebuffer_format format_{};
+
 public:
   framebuffer(GLsizei width, GLsizei height);
 
+  framebuffer(GLsizei width, GLsizei height, const framebuffer_format& format);
+
   ~framebuffer();
 
   framebuffer(const framebuffer&) = delete;
@@ -38,6 +70,11 @@ public:
   [[nodiscard]] auto width() const -> GLsizei;
 
   [[nodiscard]] auto height() const -> GLsizei;
+
+  [[nodiscard]] auto format() const -> const framebuffer_format&;
+
+  /// @brief Gets the approximate amount of GPU memory used by the attachments, in bytes.
+  [[nodiscard]] auto memory_size() const -> std::size_t;
 };
 
 } // namespace glow
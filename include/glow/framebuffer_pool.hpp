@@ -0,0 +1,83 @@
+#pragma once
+
+#include <glow/framebuffer.hpp>
+
+#include <memory>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace glow {
+
+/// @brief Hands out transient render targets and recycles them across frames.
+///
+/// @details Targets are matched by size and format. Once the pool has warmed up, acquiring and releasing targets
+///          does not create any GL objects. Targets that go unused for more than the configured number of frames
+///          are destroyed when @ref framebuffer_pool::next_frame is called.
+class framebuffer_pool final
+{
+  struct entry final
+  {
+    std::unique_ptr<framebuffer> target;
+
+    std::uint64_t last_used_frame{};
+
+    bool in_use{ false };
+  };
+
+  std::vector<entry> entries_;
+
+  std::uint64_t frame_{};
+
+  std::uint32_t max_idle_frames_{};
+
+  std::size_t allocation_count_{};
+
+public:
+  /// @param max_idle_frames The number of frames a target may go unused before it gets destroyed.
+  explicit framebuffer_pool(std::uint32_t max_idle_frames = 3);
+
+  ~framebuffer_pool();
+
+  framebuffer_pool(const framebuffer_pool&) = delete;
+
+  framebuffer_pool(framebuffer_pool&&) = delete;
+
+  auto operator=(const framebuffer_pool&) -> framebuffer_pool& = delete;
+
+  auto operator=(framebuffer_pool&&) -> framebuffer_pool& = delete;
+
+  /// @brief Gets a render target that is not currently in use.
+  ///
+  /// @return A reference to the target, which remains valid until it is released or the next frame begins.
+  ///
+  /// @note The contents of the target are undefined, since it may have been used by a previous pass.
+  [[nodiscard]] auto acquire(GLsizei width, GLsizei height, const framebuffer_format& format = {}) -> framebuffer&;
+
+  /// @brief Returns a target to the pool, so that it can be handed out again within the same frame.
+  void release(const framebuffer& target);
+
+  /// @brief Marks the end of a frame.
+  ///
+  /// @details All targets are returned to the pool and the ones that have been idle for too long are destroyed.
+  void next_frame();
+
+  /// @brief Destroys all targets that are not currently in use.
+  void trim();
+
+  void set_max_idle_frames(std::uint32_t max_idle_frames);
+
+  /// @brief Gets the approximate amount of GPU memory owned by the pool, in bytes.
+  [[nodiscard]] auto memory_usage() const -> std::size_t;
+
+  /// @brief Gets the number of targets owned by the pool.
+  [[nodiscard]] auto size() const -> std::size_t;
+
+  /// @brief Gets the total number of targets that the pool has had to create.
+  ///
+  /// @note This can be used to check that a frame loop has reached a steady state.
+  [[nodiscard]] auto allocation_count() const -> std::size_t;
+};
+
+} // namespace glow
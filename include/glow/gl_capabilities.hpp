@@ -0,0 +1,72 @@
+#pragma once
+
+namespace glow {
+
+/// @brief The OpenGL ES context versions that a platform can be asked to create.
+enum class context_version
+{
+  /// @brief OpenGL ES 2.0, or WebGL 1 in the browser.
+  es_2_0,
+  /// @brief OpenGL ES 3.0, or WebGL 2 in the browser.
+  es_3_0
+};
+
+/// @brief Describes what the current context actually supports.
+///
+/// @details A context may be older than the one requested (for example, when a driver or browser has no ES 3.0
+///          support), so code paths that depend on ES 3.0 features should check here first.
+struct gl_capabilities final
+{
+  int major_version{ 2 };
+
+  int minor_version{ 0 };
+
+  /// @brief Whether the context is a WebGL context.
+  bool webgl{ false };
+
+  /// @brief Whether @c glDrawArraysInstanced and @c glVertexAttribDivisor are available.
+  bool instancing{ false };
+
+  /// @brief Whether @c GL_PIXEL_PACK_BUFFER and @c GL_PIXEL_UNPACK_BUFFER are available.
+  bool pixel_buffer_objects{ false };
+
+  /// @brief Whether programs can be saved and restored with @c glGetProgramBinary and @c glProgramBinary.
+  bool program_binaries{ false };
+
+  /// @brief Whether a framebuffer can have more than one color attachment.
+  bool multiple_render_targets{ false };
+
+  /// @brief Whether uniform blocks (and @ref uniform_ring) can be used.
+  bool uniform_buffers{ false };
+
+  /// @brief Whether sized internal formats such as @c GL_RGBA16F and @c GL_R8 are available.
+  bool sized_texture_formats{ false };
+
+  int max_texture_size{ 0 };
+
+  int max_draw_buffers{ 1 };
+
+  int max_uniform_block_size{ 0 };
+
+  int max_samples{ 0 };
+
+  /// @brief Checks whether the context version is at least the given version.
+  [[nodiscard]] auto at_least(int major, int minor) const -> bool
+  {
+    return (major_version > major) || ((major_version == major) && (minor_version >= minor));
+  }
+
+  /// @brief Gets the @c #version directive that matches the context, for use with the ImGui backend.
+  [[nodiscard]] auto glsl_version_directive() const -> const char*
+  {
+    return at_least(3, 0) ? "#version 300 es" : "#version 100";
+  }
+};
+
+/// @brief Queries the capabilities of the current context.
+///
+/// @note A context must be current when this is called.
+auto
+query_gl_capabilities() -> gl_capabilities;
+
+} // namespace glow
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <GLES3/gl3.h>
+
+#include <array>
+
+#include <cstddef>
+
+namespace glow {
+
+/// @brief A shadow copy of the commonly changed parts of the GL state, used to drop redundant state changes.
+///
+/// @details Each setter compares the requested value against the last one it forwarded to GL, and only calls into the
+///          driver when the value differs. Anything not covered here (such as texture parameters or vertex attribute
+///          pointers) should still be set through GL directly.
+///
+///          There is one cache per thread, obtained with @ref gl_state::current. It assumes that one context is current
+///          on that thread. Code that changes the covered state without going through the cache (such as the ImGui
+///          backend, or another library) must be followed by a call to @ref invalidate. The hosts do this after each
+///          call to @c ImGui_ImplOpenGL3_RenderDrawData.
+///
+/// @note When deleting an object that may still be bound, call the matching @c forget_ function. Otherwise a newly
+///       generated object that reuses the name would be considered already bound.
+class gl_state final
+{
+public:
+  /// @brief Gets the cache for the calling thread.
+  static auto current() -> gl_state&;
+
+  gl_state();
+
+  gl_state(const gl_state&) = delete;
+
+  gl_state(gl_state&&) = delete;
+
+  auto operator=(const gl_state&) -> gl_state& = delete;
+
+  auto operator=(gl_state&&) -> gl_state& = delete;
+
+  ~gl_state() = default;
+
+  /// @brief Marks all of the state as unknown, so that the next call to each setter is forwarded to GL.
+  void invalidate();
+
+  void use_program(GLuint program);
+
+  /// @param unit The index of the texture unit (not @c GL_TEXTURE0 + index).
+  void active_texture(GLuint unit);
+
+  /// @brief Binds a texture to the active texture unit.
+  void bind_texture(GLenum target, GLuint texture);
+
+  /// @brief Makes a texture unit active and binds a texture to it.
+  void bind_texture(GLuint unit, GLenum target, GLuint texture);
+
+  void bind_buffer(GLenum target, GLuint buffer);
+
+  /// @brief Calls @c glBindBufferRange, which also changes the generic binding of the target.
+  void bind_buffer_range(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size);
+
+  void bind_vertex_array(GLuint vertex_array);
+
+  /// @param target Either @c GL_FRAMEBUFFER (which sets both), @c GL_DRAW_FRAMEBUFFER or @c GL_READ_FRAMEBUFFER.
+  void bind_framebuffer(GLenum target, GLuint framebuffer);
+
+  void enable(GLenum capability);
+
+  void disable(GLenum capability);
+
+  void set_enabled(GLenum capability, bool enabled);
+
+  void blend_func(GLenum src, GLenum dst);
+
+  void blend_func_separate(GLenum src_rgb, GLenum dst_rgb, GLenum src_alpha, GLenum dst_alpha);
+
+  void viewport(GLint x, GLint y, GLsizei w, GLsizei h);
+
+  void scissor(GLint x, GLint y, GLsizei w, GLsizei h);
+
+  /// @brief Gets the framebuffer last bound to @c GL_DRAW_FRAMEBUFFER through the cache, querying it if unknown.
+  [[nodiscard]] auto draw_framebuffer() -> GLuint;
+
+  void forget_program(GLuint program);
+
+  void forget_texture(GLuint texture);
+
+  void forget_buffer(GLuint buffer);
+
+  void forget_vertex_array(GLuint vertex_array);
+
+  void forget_framebuffer(GLuint framebuffer);
+
+  /// @brief Gets the number of state changes that were forwarded to GL.
+  [[nodiscard]] auto call_count() const -> std::size_t;
+
+  /// @brief Gets the number of state changes that were dropped because they would not have changed anything.
+  [[nodiscard]] auto skip_count() const -> std::size_t;
+
+private:
+  template<typename T>
+  struct slot final
+  {
+    T value{};
+
+    bool known{ false };
+  };
+
+  /// @brief Records a new value for a slot, returning whether the call needs to be made.
+  template<typename T>
+  auto update(slot<T>& s, const T& value) -> bool;
+
+  static constexpr std::size_t max_texture_units{ 32 };
+
+  static constexpr std::size_t texture_target_count{ 4 };
+
+  static constexpr std::size_t buffer_target_count{ 8 };
+
+  static constexpr std::size_t capability_count{ 11 };
+
+  slot<GLuint> program_;
+
+  slot<GLuint> active_texture_;
+
+  std::array<std::array<slot<GLuint>, texture_target_count>, max_texture_units> textures_;
+
+  std::array<slot<GLuint>, buffer_target_count> buffers_;
+
+  slot<GLuint> vertex_array_;
+
+  slot<GLuint> draw_framebuffer_;
+
+  slot<GLuint> read_framebuffer_;
+
+  std::array<slot<bool>, capability_count> capabilities_;
+
+  slot<std::array<GLenum, 4>> blend_func_;
+
+  slot<std::array<GLint, 4>> viewport_;
+
+  slot<std::array<GLint, 4>> scissor_;
+
+  std::size_t call_count_{ 0 };
+
+  std::size_t skip_count_{ 0 };
+};
+
+} // namespace glow
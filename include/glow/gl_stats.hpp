@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+
+namespace glow {
+
+/// @brief Counts the GL calls made over one frame.
+struct gl_call_stats final
+{
+  /// @brief The total number of GL calls.
+  std::size_t calls{ 0 };
+
+  /// @brief The number of @c glDraw* calls.
+  std::size_t draw_calls{ 0 };
+
+  /// @brief The number of calls that bind objects or change fixed function state.
+  std::size_t state_changes{ 0 };
+
+  /// @brief The number of bytes passed to @c glTexImage* and @c glTexSubImage* (including compressed variants).
+  std::size_t texture_upload_bytes{ 0 };
+
+  /// @brief The number of bytes passed to @c glBufferData and @c glBufferSubData.
+  std::size_t buffer_upload_bytes{ 0 };
+
+  /// @brief The number of @c glGetError calls, each of which may stall until the GPU catches up.
+  std::size_t error_checks{ 0 };
+};
+
+/// @brief Whether the GL loader was built with call hooks (the @c GLOW_GL_STATS CMake option).
+///
+/// @details Without the hooks, all of the counters stay at zero.
+auto
+gl_call_stats_available() -> bool;
+
+/// @brief Starts counting GL calls.
+///
+/// @details This must be called after the loader has been initialized. It replaces the loader's default post-call hook,
+///          which would otherwise check @c glGetError after every call.
+///
+/// @note This does nothing if @ref gl_call_stats_available returns false.
+void
+install_gl_call_hooks();
+
+/// @brief Ends the current frame, making its counters available through @ref get_gl_call_stats.
+void
+end_gl_call_stats_frame();
+
+/// @brief Gets the counters of the last completed frame.
+///
+/// @note The counters are not synchronized, so the GL calls are expected to be made from one thread.
+auto
+get_gl_call_stats() -> gl_call_stats;
+
+} // namespace glow
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <GLES3/gl3.h>
+
+#include <cstddef>
+
+namespace glow {
+
+/// @brief Measures how long the GPU spends on a sequence of commands.
+///
+/// @details This uses @c GL_EXT_disjoint_timer_query when it is available. Results are read back a few frames later,
+///          so that measuring never stalls the pipeline. When the extension is missing, or the context is older than
+///          ES 3.0 (which the query functions used here belong to), @ref gpu_timer::supported returns false and no
+///          measurements are made.
+class gpu_timer final
+{
+  static constexpr std::size_t query_count{ 4 };
+
+  GLuint queries_[query_count]{};
+
+  std::size_t head_{};
+
+  std::size_t in_flight_{};
+
+  bool supported_{ false };
+
+  bool active_{ false };
+
+  float elapsed_ms_{ -1.0f };
+
+public:
+  gpu_timer();
+
+  ~gpu_timer();
+
+  gpu_timer(const gpu_timer&) = delete;
+
+  gpu_timer(gpu_timer&&) = delete;
+
+  auto operator=(const gpu_timer&) -> gpu_timer& = delete;
+
+  auto operator=(gpu_timer&&) -> gpu_timer& = delete;
+
+  [[nodiscard]] auto supported() const -> bool;
+
+  /// @brief Starts measuring the commands issued from this point.
+  ///
+  /// @note If too many measurements are still waiting on the GPU, this measurement is skipped.
+  void begin();
+
+  void end();
+
+  /// @brief Reads back any measurements that have completed.
+  ///
+  /// @return True if a new measurement became available.
+  auto poll() -> bool;
+
+  /// @brief Gets the most recent completed measurement, in milliseconds, or a negative value if there is none yet.
+  [[nodiscard]] auto elapsed_ms() const -> float;
+};
+
+} // namespace glow
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <implot.h>
+
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace glow {
+
+/// @brief Plots very long line series by reducing them to the minimum and maximum of each pixel column.
+///
+/// @details Lines with many more samples than the plot has pixels are reduced, for the current axis limits and plot
+///          width, to at most two points per pixel column. Peaks and dropouts stay visible, and ImGui only has to build
+///          vertices for the reduced points. When the view shows few enough samples, they are plotted as they are.
+///
+///          The reduced points are kept until the data or the view changes. The data is identified by its address,
+///          size, stride and a version number, which the caller must change whenever the values change in place. A
+///          summary of each block of samples is also kept for the current version, so zooming and panning over a
+///          whole capture only visits the blocks and the samples at the edges of each column.
+///
+/// @note The x values must be in ascending order. Lines drawn with @c ImPlotLineFlags_Segments or
+///       @c ImPlotLineFlags_Loop are plotted without being reduced, since reducing them would change their shape.
+///
+/// @note The plot functions must be called between @c ImPlot::BeginPlot and @c ImPlot::EndPlot.
+class line_decimator final
+{
+public:
+  line_decimator() = default;
+
+  line_decimator(const line_decimator&) = delete;
+
+  line_decimator(line_decimator&&) = delete;
+
+  auto operator=(const line_decimator&) -> line_decimator& = delete;
+
+  auto operator=(line_decimator&&) -> line_decimator& = delete;
+
+  ~line_decimator() = default;
+
+  /// @brief Plots values whose x coordinates are implied by their index.
+  ///
+  /// @param x_scale The distance between samples on the x axis, which must be positive.
+  ///
+  /// @param x_start The x coordinate of the first sample.
+  ///
+  /// @param version Identifies the values at this address. Change it whenever the values are modified.
+  ///
+  /// @param stride The distance between values, in bytes.
+  template<typename T>
+  void plot(const char* label,
+            const T* ys,
+            std::size_t count,
+            double x_scale = 1.0,
+            double x_start = 0.0,
+            ImPlotLineFlags flags = 0,
+            std::uint64_t version = 0,
+            int stride = sizeof(T));
+
+  /// @brief Plots points with explicit x coordinates, which must be in ascending order.
+  template<typename T>
+  void plot(const char* label,
+            const T* xs,
+            const T* ys,
+            std::size_t count,
+            ImPlotLineFlags flags = 0,
+            std::uint64_t version = 0,
+            int stride = sizeof(T));
+
+  /// @brief Discards the cached points and block summary, forcing them to be rebuilt on the next plot.
+  void invalidate();
+
+  /// @brief Gets the number of points that were handed to ImPlot by the last plot call.
+  [[nodiscard]] auto point_count() const -> std::size_t;
+
+private:
+  /// @brief The minimum and maximum of a fixed number of consecutive samples.
+  struct block final
+  {
+    double min;
+
+    double max;
+
+    std::size_t min_index;
+
+    std::size_t max_index;
+  };
+
+  /// @brief Identifies the data that the cache was built from.
+  struct source final
+  {
+    const void* xs{ nullptr };
+
+    const void* ys{ nullptr };
+
+    std::size_t count{};
+
+    int stride{};
+
+    std::uint64_t version{};
+
+    double x_scale{};
+
+    double x_start{};
+
+    [[nodiscard]] auto operator==(const source& other) const -> bool;
+  };
+
+  template<typename T>
+  void plot_impl(const char* label,
+                 const T* xs,
+                 const T* ys,
+                 std::size_t count,
+                 double x_scale,
+                 double x_start,
+                 ImPlotLineFlags flags,
+                 std::uint64_t version,
+                 int stride);
+
+  std::vector<block> blocks_;
+
+  std::vector<double> xs_;
+
+  std::vector<double> ys_;
+
+  /// @brief The x coordinates of the pixel column edges, reused between rebuilds.
+  std::vector<double> edges_;
+
+  source source_;
+
+  double x_min_{};
+
+  double x_max_{};
+
+  int width_{};
+
+  bool has_blocks_{ false };
+
+  bool has_points_{ false };
+
+  std::size_t point_count_{};
+};
+
+} // namespace glow
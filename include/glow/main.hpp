@@ -6,8 +6,15 @@
 
 #include <imgui.h>
 
+#include <glow/gl_capabilities.hpp>
+#include <glow/gl_stats.hpp>
+
 namespace glow {
 
+class plot_batch;
+
+class shader_warmup;
+
 class platform
 {
 public:
@@ -67,16 +74,57 @@ public:
   }
 
   virtual void save_file_dialog(const char* title, void* cb_data, void (*cb_func)(void*, const char* file_path)) {}
+
+  /// @brief Gets the queue of programs to compile before the application starts rendering.
+  ///
+  /// @details Programs queued during @ref app::setup (for example, with @ref shader_warmup::load_manifest) are compiled
+  ///          across the first few frames, with a progress bar shown in the meantime. @ref app::loop is not called
+  ///          until they are all done. The programs can then be retrieved by name.
+  ///
+  /// @return The warm-up queue, or null if the platform does not support it.
+  virtual auto get_shader_warmup() -> shader_warmup* { return nullptr; }
+
+  /// @brief Gets the plot series that are reduced in parallel before each frame.
+  ///
+  /// @details Series registered with it (usually during @ref app::setup) are reduced on worker threads before each call
+  ///          to @ref app::loop, so that plotting them in the loop does not have to go through their samples. The batch
+  ///          and its worker threads are created the first time this is called.
+  ///
+  /// @return The plot batch, or null if the platform does not support it.
+  virtual auto get_plot_batch() -> plot_batch* { return nullptr; }
+
+  /// @brief Gets what the context that was actually created supports.
+  ///
+  /// @note This may describe an older context than the one returned by @ref app::get_context_version, if that version
+  ///       was not available. Platforms that do not override it report an ES 2.0 context without optional features.
+  virtual auto get_capabilities() const -> const gl_capabilities&
+  {
+    static const gl_capabilities es_2_0;
+    return es_2_0;
+  }
+
+  /// @brief Gets the number of GL calls made during the last frame.
+  ///
+  /// @note The counters are only collected when glow is built with the @c GLOW_GL_STATS option.
+  virtual auto get_gl_call_stats() const -> gl_call_stats { return {}; }
 };
 
 class app
 {
 public:
-  /// @note This should be defined by the library user, in order to create the application.
+  /// @note This should be defined by the library user, in order to create the application. It is called before the
+  ///       window and context are created, so GL resources should be created in @ref setup instead.
   static auto create() -> std::unique_ptr<app>;
 
   virtual ~app() = default;
 
+  /// @brief Gets the context version to request when creating the window.
+  ///
+  /// @details This is called before the window and context exist, so it should not touch any GL state. If the
+  ///          requested version is not available, the platform falls back to ES 2.0. Use
+  ///          @ref platform::get_capabilities to find out what was created.
+  virtual auto get_context_version() const -> context_version { return context_version::es_3_0; }
+
   /// @brief The entry point of the application.
   virtual void setup(platform&) = 0;
 
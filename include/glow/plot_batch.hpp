@@ -0,0 +1,208 @@
+#pragma once
+
+#include <glow/task_pool.hpp>
+
+#include <imgui.h>
+#include <implot.h>
+
+#include <memory>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace glow {
+
+/// @brief Statistics of the samples of a series that were in view.
+struct series_stats final
+{
+  double min;
+
+  double max;
+
+  /// @brief The mean of the values that are not NaN.
+  double mean;
+
+  /// @brief The number of samples in view, including NaN.
+  std::size_t count;
+};
+
+/// @brief Reduces the lines of many plot series in parallel, before each frame is drawn.
+///
+/// @details Series are registered once, with the array holding their values. Before each call to @ref app::loop, the
+///          platform reduces every series that was plotted in the last frame on the worker threads of a
+///          @ref task_pool, and waits for them. When a series is plotted, its line is then ready and only has to be
+///          passed to ImPlot.
+///
+///          Each series is reduced separately for every plot it was shown in during the last frame, so that a series
+///          can be shown in an overview and in a zoomed plot at the same time. The view of each plot is widened by half
+///          of it on each side, and reduced to the minimum and maximum of runs of samples that each cover about one
+///          pixel column. This means the line lags the view by one frame, which is only noticeable when zooming out (the
+///          edges are filled in the next frame). A series that was not reduced for the current frame and plot, for
+///          example because it was just added or was hidden, is reduced when it is plotted instead.
+///
+///          The values of each series are read between frames, from the worker threads. So they must only be modified
+///          during @ref app::loop (or whenever the platform is not between frames), and @ref set_series_data must be
+///          called whenever the array is moved or resized.
+///
+/// @note Samples are evenly spaced, with sample @c i at <tt>x_start + i * x_scale</tt>.
+class plot_batch final
+{
+public:
+  /// @param threads The number of worker threads, where zero picks one less than the number of hardware threads.
+  explicit plot_batch(std::size_t threads = 0);
+
+  plot_batch(const plot_batch&) = delete;
+
+  plot_batch(plot_batch&&) = delete;
+
+  auto operator=(const plot_batch&) -> plot_batch& = delete;
+
+  auto operator=(plot_batch&&) -> plot_batch& = delete;
+
+  ~plot_batch();
+
+  /// @brief Registers a series. The values are not copied, and must outlive the series.
+  ///
+  /// @note This is defined for @c float, @c double and @c std::int16_t.
+  ///
+  /// @return The identifier of the series, which may be reused after it is removed.
+  template<typename T>
+  auto add_series(const T* values, std::size_t count, double x_scale = 1.0, double x_start = 0.0) -> std::size_t;
+
+  /// @brief Changes the values of a series, or just the number of them.
+  ///
+  /// @note The line is updated in the next frame, so this can be called before plotting the series in the same frame.
+  template<typename T>
+  void set_series_data(std::size_t id, const T* values, std::size_t count, double x_scale = 1.0, double x_start = 0.0);
+
+  /// @brief Enables the statistics of the samples in view, which are gathered along with the line.
+  void set_stats_enabled(std::size_t id, bool enabled);
+
+  void remove_series(std::size_t id);
+
+  void clear();
+
+  /// @brief Starts reducing the series on the worker threads. This is called by the platform at the start of a frame.
+  void begin_frame();
+
+  /// @brief Waits for the series to be reduced, helping out in the meantime. This is called by the platform just
+  ///        before @ref app::loop.
+  void end_frame();
+
+  /// @brief Plots the reduced line of a series, and uses the current view when reducing it for the next frame.
+  ///
+  /// @note This must be called between @c ImPlot::BeginPlot and @c ImPlot::EndPlot.
+  void plot_line(const char* label, std::size_t id, ImPlotLineFlags flags = 0);
+
+  /// @brief Shades the area between the minimum and maximum of each run of samples of a series.
+  ///
+  /// @note This must be called between @c ImPlot::BeginPlot and @c ImPlot::EndPlot.
+  void plot_envelope(const char* label, std::size_t id, ImPlotShadedFlags flags = 0);
+
+  /// @brief Gets the statistics of the samples of a series that were in view when it was last reduced.
+  ///
+  /// @note The statistics are NaN, with a count of zero, until they are enabled and the series is reduced. If the series
+  ///       is shown in more than one plot, they are for the plot that it was last plotted in.
+  [[nodiscard]] auto stats(std::size_t id) const -> series_stats;
+
+  /// @brief Gets the number of series that are registered.
+  [[nodiscard]] auto series_count() const -> std::size_t;
+
+  /// @brief Gets the pool that the series are reduced on, which apps may use for their own work between frames.
+  [[nodiscard]] auto get_task_pool() -> task_pool&;
+
+private:
+  enum class value_type
+  {
+    float32,
+    float64,
+    int16
+  };
+
+  /// @brief The reduction of a series for one of the plots that it is shown in.
+  struct view final
+  {
+    /// @brief The ID of the plot, where zero means that the series was not plotted yet and the view is not known.
+    ImGuiID plot_id{};
+
+    double min{};
+
+    double max{};
+
+    int width{};
+
+    /// @brief The frame in which the series was last plotted in the plot.
+    std::uint64_t plotted_frame{};
+
+    /// @brief The frame that the view was last reduced for, where zero means it never was.
+    std::uint64_t reduced_frame{};
+
+    std::vector<double> xs;
+
+    std::vector<double> ys;
+
+    std::vector<double> starts;
+
+    std::vector<double> mins;
+
+    std::vector<double> maxs;
+
+    series_stats stats{};
+  };
+
+  struct series final
+  {
+    const void* values{ nullptr };
+
+    value_type type{ value_type::float64 };
+
+    std::size_t count{};
+
+    double x_scale{ 1.0 };
+
+    double x_start{};
+
+    bool stats_enabled{ false };
+
+    std::vector<view> views;
+
+    /// @brief The ID of the plot that the series was last plotted in.
+    ImGuiID last_plot_id{};
+  };
+
+  /// @brief A view to reduce on the worker threads.
+  struct task final
+  {
+    const series* s{ nullptr };
+
+    view* v{ nullptr };
+  };
+
+  auto add(const void* values, value_type type, std::size_t count, double x_scale, double x_start) -> std::size_t;
+
+  void set(std::size_t id, const void* values, value_type type, std::size_t count, double x_scale, double x_start);
+
+  [[nodiscard]] auto get_series(std::size_t id) const -> series&;
+
+  /// @brief Gets the view of a series in the current plot, reducing it first if it was not reduced for this frame.
+  auto prepare(std::size_t id) -> view&;
+
+  /// @brief Reduces one view of a series, which is safe to call from any thread as long as each view is only reduced
+  ///        once at a time.
+  static void reduce(const series& s, view& v);
+
+  std::vector<std::unique_ptr<series>> series_;
+
+  /// @brief The views being reduced on the worker threads.
+  std::vector<task> pending_;
+
+  /// @brief The number of the current frame, starting at one.
+  std::uint64_t frame_{ 1 };
+
+  bool reducing_{ false };
+
+  task_pool pool_;
+};
+
+} // namespace glow
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <implot.h>
+
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+
+namespace glow {
+
+/// @brief A fixed-size window of streaming samples that can be plotted without being shifted or copied.
+///
+/// @details Samples are stored as interleaved rows of @c double values, with an optional time column first and then
+///          one column per channel. Appending a block of rows costs one or two @c memcpy calls, regardless of the
+///          size of the window. Plotting hands the storage to ImPlot as is, using its offset parameter to start at the
+///          oldest row, so each frame costs nothing beyond what ImPlot itself does.
+class plot_ring final
+{
+public:
+  /// @param capacity The maximum number of rows to keep.
+  ///
+  /// @param channels The number of values in each row, not counting the time.
+  ///
+  /// @param has_time Whether each row starts with a time value, used as the x coordinate when plotting.
+  plot_ring(std::size_t capacity, std::size_t channels, bool has_time = false);
+
+  plot_ring(const plot_ring&) = delete;
+
+  plot_ring(plot_ring&&) = delete;
+
+  auto operator=(const plot_ring&) -> plot_ring& = delete;
+
+  auto operator=(plot_ring&&) -> plot_ring& = delete;
+
+  ~plot_ring() = default;
+
+  /// @brief Appends rows, dropping the oldest ones once the ring is full.
+  ///
+  /// @param rows The row-major values, with @ref columns values per row.
+  ///
+  /// @param row_count The number of rows to append.
+  void append(const double* rows, std::size_t row_count);
+
+  void clear();
+
+  /// @brief Plots one channel as a line.
+  ///
+  /// @param x_scale Without a time column, the x coordinate is the index of the sample (counting all of the samples
+  ///                ever appended) multiplied by this value.
+  void plot_line(const char* label, std::size_t channel, ImPlotLineFlags flags = 0, double x_scale = 1.0) const;
+
+  void plot_scatter(const char* label,
+                    std::size_t channel,
+                    ImPlotScatterFlags flags = 0,
+                    double x_scale = 1.0) const;
+
+  /// @brief Gets the x coordinates of the oldest and newest rows, for keeping a plot axis scrolled to the data.
+  [[nodiscard]] auto x_range(double x_scale = 1.0) const -> std::pair<double, double>;
+
+  [[nodiscard]] auto size() const -> std::size_t;
+
+  [[nodiscard]] auto capacity() const -> std::size_t;
+
+  [[nodiscard]] auto channels() const -> std::size_t;
+
+  /// @brief Gets the number of values in each row, which includes the time column.
+  [[nodiscard]] auto columns() const -> std::size_t;
+
+  [[nodiscard]] auto has_time() const -> bool;
+
+  /// @brief Gets the number of rows appended since the ring was created or cleared.
+  [[nodiscard]] auto total_count() const -> std::size_t;
+
+private:
+  /// @brief Gets the ImPlot offset of the oldest row.
+  [[nodiscard]] auto offset() const -> int;
+
+  /// @brief Gets the first value of a column.
+  [[nodiscard]] auto column(std::size_t index) const -> const double*;
+
+  [[nodiscard]] auto value_column(std::size_t channel) const -> const double*;
+
+  std::vector<double> data_;
+
+  std::size_t capacity_{};
+
+  std::size_t channels_{};
+
+  std::size_t columns_{};
+
+  std::size_t head_{};
+
+  std::size_t size_{};
+
+  std::size_t total_{};
+
+  bool has_time_{ false };
+};
+
+} // namespace glow
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <glow/framebuffer.hpp>
+#include <glow/framebuffer_pool.hpp>
+#include <glow/screen_quad.hpp>
+
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+
+namespace glow {
+
+/// @brief Runs an ordered list of full screen shader passes over a texture.
+///
+/// @details Each pass renders into a framebuffer taken from a @ref framebuffer_pool, which is sized relative to the
+///          input by the pass's resolution scale, and the output of one pass becomes the input of the next. Passes are
+///          drawn with @ref screen_quad::draw_triangle, so no vertex attributes are involved.
+///
+///          Fragment shaders are compiled as GLSL ES 3.00 (the version line is added automatically) and may use the
+///          following:
+///
+///          - @c texcoord (in vec2) The texture coordinates of the fragment.
+///          - @c input_texture (uniform sampler2D) The output of the previous pass.
+///          - @c input_texel_size (uniform vec2) The size of a texel in @c input_texture.
+///          - @c source_texture (uniform sampler2D) The input of the first pass.
+///
+///          The output color must be written to a variable declared as @c out vec4.
+class post_chain final
+{
+public:
+  using defines = std::vector<std::pair<std::string, std::string>>;
+
+  /// @brief Called after a pass's program is bound, in order to set any additional uniforms.
+  using uniform_callback = std::function<void(GLuint program)>;
+
+  explicit post_chain(framebuffer_pool& pool);
+
+  post_chain(const post_chain&) = delete;
+
+  post_chain(post_chain&&) = delete;
+
+  auto operator=(const post_chain&) -> post_chain& = delete;
+
+  auto operator=(post_chain&&) -> post_chain& = delete;
+
+  ~post_chain();
+
+  /// @brief Compiles and appends a pass to the chain.
+  ///
+  /// @param resolution_scale The size of the pass's output, relative to the size of the chain's input.
+  ///
+  /// @return The index of the pass.
+  ///
+  /// @note This function throws a @ref shader_error if the shader fails to compile.
+  auto add_pass(const char* frag_source,
+                float resolution_scale = 1.0f,
+                const defines& defs = {},
+                uniform_callback callback = {}) -> std::size_t;
+
+  void set_resolution_scale(std::size_t pass_index, float resolution_scale);
+
+  void set_enabled(std::size_t pass_index, bool enabled);
+
+  void set_uniform_callback(std::size_t pass_index, uniform_callback callback);
+
+  /// @brief Sets the format of the intermediate framebuffers.
+  void set_format(const framebuffer_format& format);
+
+  /// @brief Gets the program of a pass, for looking up uniform locations.
+  [[nodiscard]] auto program(std::size_t pass_index) const -> GLuint;
+
+  [[nodiscard]] auto pass_count() const -> std::size_t;
+
+  /// @brief Runs the enabled passes over a texture.
+  ///
+  /// @return The framebuffer containing the output of the last pass, or null if no pass is enabled. It belongs to the
+  ///         pool and remains valid until the pool's next frame begins.
+  auto run(GLuint input_texture, GLsizei width, GLsizei height) -> framebuffer*;
+
+private:
+  struct pass final
+  {
+    GLuint program{};
+
+    GLint input_texture_location{ -1 };
+
+    GLint input_texel_size_location{ -1 };
+
+    GLint source_texture_location{ -1 };
+
+    float resolution_scale{ 1.0f };
+
+    bool enabled{ true };
+
+    uniform_callback callback;
+  };
+
+  framebuffer_pool* pool_{ nullptr };
+
+  screen_quad quad_;
+
+  framebuffer_format format_;
+
+  std::vector<pass> passes_;
+};
+
+} // namespace glow
@@ -0,0 +1,219 @@
+#pragma once
+
+#include <GLES3/gl3.h>
+
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace glow {
+
+/// @brief Refers to an active uniform of a @ref program, so that it can be set without a string lookup.
+struct uniform_handle final
+{
+  int index{ -1 };
+
+  [[nodiscard]] auto valid() const -> bool { return index >= 0; }
+};
+
+/// @brief Owns a linked program and reflects its active uniforms and attributes.
+///
+/// @details All active uniforms and attributes are queried once, when the object is created, and stored in flat hash
+///          tables. The setters keep a shadow copy of every uniform value and skip the @c glUniform call when the value
+///          has not changed.
+///
+/// @note The setters apply to the currently bound program, so @ref program::use must be called first. Setting a
+///       uniform with @c glUniform directly will cause the shadow copy to go stale.
+class program final
+{
+public:
+  /// @brief Takes ownership of a linked program, such as one returned by @ref compile_shader.
+  explicit program(GLuint id);
+
+  program(const program&) = delete;
+
+  program(program&&) = delete;
+
+  auto operator=(const program&) -> program& = delete;
+
+  auto operator=(program&&) -> program& = delete;
+
+  ~program();
+
+  [[nodiscard]] auto id() const -> GLuint;
+
+  void use();
+
+  /// @brief Finds an active uniform by name.
+  ///
+  /// @note Array uniforms can be found by their name with or without the @c [0] suffix.
+  [[nodiscard]] auto find_uniform(const char* name) const -> uniform_handle;
+
+  /// @brief Gets the location of an active uniform, or -1 if there is none with that name.
+  [[nodiscard]] auto uniform_location(const char* name) const -> GLint;
+
+  /// @brief Gets the location of an active attribute, or -1 if there is none with that name.
+  [[nodiscard]] auto attrib_location(const char* name) const -> GLint;
+
+  void set(uniform_handle u, float x);
+
+  void set(uniform_handle u, float x, float y);
+
+  void set(uniform_handle u, float x, float y, float z);
+
+  void set(uniform_handle u, float x, float y, float z, float w);
+
+  void set(uniform_handle u, int x);
+
+  void set(uniform_handle u, int x, int y);
+
+  void set(uniform_handle u, int x, int y, int z);
+
+  void set(uniform_handle u, int x, int y, int z, int w);
+
+  void set(uniform_handle u, unsigned int x);
+
+  void set(uniform_handle u, unsigned int x, unsigned int y);
+
+  void set(uniform_handle u, unsigned int x, unsigned int y, unsigned int z);
+
+  void set(uniform_handle u, unsigned int x, unsigned int y, unsigned int z, unsigned int w);
+
+  /// @brief Forwards other arithmetic types to the @c float, @c int or <tt>unsigned int</tt> overloads.
+  ///
+  /// @details Floating point values are converted to @c float, unsigned integers to <tt>unsigned int</tt>, and other
+  ///          integers (including @c bool, or a mix of signed and unsigned integers) to @c int, so that calls such as
+  ///          <tt>set(u, 0.5)</tt> are not ambiguous.
+  ///
+  /// @note The integer overloads use the unsigned variants of @c glUniform for @c uint and @c uvec uniforms, and the
+  ///       signed variants otherwise, whichever type the values have.
+  template<typename... Args, typename = std::enable_if_t<(std::is_arithmetic_v<Args> && ...)>>
+  void set(const uniform_handle u, const Args... args)
+  {
+    static_assert((sizeof...(Args) >= 1) && (sizeof...(Args) <= 4), "A uniform is set with one to four values.");
+
+    static_assert((std::is_floating_point_v<Args> && ...) || (std::is_integral_v<Args> && ...),
+                  "The values of a uniform must either all be floating point or all be integers.");
+
+    using integer =
+      std::conditional_t<((std::is_unsigned_v<Args> && !std::is_same_v<Args, bool>) && ...), unsigned int, int>;
+
+    using value = std::conditional_t<(std::is_floating_point_v<Args> && ...), float, integer>;
+
+    set(u, static_cast<value>(args)...);
+  }
+
+  /// @brief Sets a column-major 3x3 matrix.
+  void set_matrix3(uniform_handle u, const float* m);
+
+  /// @brief Sets a column-major 4x4 matrix.
+  void set_matrix4(uniform_handle u, const float* m);
+
+  /// @brief Sets the first elements of a uniform array with a floating point type.
+  ///
+  /// @details The number of components per element is taken from the type of the uniform, so @p values holds
+  ///          @p count vectors or column-major matrices. Elements past the end of the array are ignored.
+  void set_array(uniform_handle u, const float* values, std::size_t count);
+
+  /// @brief Sets the first elements of a uniform array with an integer, boolean or sampler type.
+  void set_array(uniform_handle u, const int* values, std::size_t count);
+
+  /// @brief Sets the first elements of a uniform array with an unsigned integer type.
+  void set_array(uniform_handle u, const unsigned int* values, std::size_t count);
+
+  template<typename... Args>
+  void set(const char* name, Args... args)
+  {
+    set(find_uniform(name), args...);
+  }
+
+  void set_matrix3(const char* name, const float* m) { set_matrix3(find_uniform(name), m); }
+
+  void set_matrix4(const char* name, const float* m) { set_matrix4(find_uniform(name), m); }
+
+  void set_array(const char* name, const float* values, const std::size_t count)
+  {
+    set_array(find_uniform(name), values, count);
+  }
+
+  void set_array(const char* name, const int* values, const std::size_t count)
+  {
+    set_array(find_uniform(name), values, count);
+  }
+
+  void set_array(const char* name, const unsigned int* values, const std::size_t count)
+  {
+    set_array(find_uniform(name), values, count);
+  }
+
+  /// @brief Gets the number of @c glUniform calls that have been issued through this object.
+  [[nodiscard]] auto upload_count() const -> std::uint64_t;
+
+  /// @brief Gets the number of @c glUniform calls that were skipped because the value did not change.
+  [[nodiscard]] auto skip_count() const -> std::uint64_t;
+
+private:
+  struct variable final
+  {
+    std::string name;
+
+    GLint location{ -1 };
+
+    GLenum type{};
+
+    GLint array_size{};
+
+    /// @brief The offset of the shadow copy, in bytes.
+    std::size_t shadow_offset{};
+  };
+
+  /// @brief An open addressing hash table that maps names to indices of a variable list.
+  class name_table final
+  {
+    struct slot final
+    {
+      std::uint32_t hash{};
+
+      int index{ -1 };
+    };
+
+    std::vector<slot> slots_;
+
+  public:
+    void build(const std::vector<variable>& variables);
+
+    [[nodiscard]] auto find(const std::vector<variable>& variables, const char* name) const -> int;
+
+  private:
+    void insert(const std::vector<variable>& variables, const char* name, int index);
+  };
+
+  /// @brief Updates the shadow copy of a uniform.
+  ///
+  /// @return True if the value changed and needs to be uploaded.
+  auto update_shadow(uniform_handle u, const void* data, std::size_t size) -> bool;
+
+  /// @brief Uploads the elements of an integer uniform (or array), which hold 32-bit signed or unsigned values.
+  void set_integers(uniform_handle u, const void* values, int components, std::size_t count);
+
+  GLuint id_{};
+
+  std::vector<variable> uniforms_;
+
+  std::vector<variable> attributes_;
+
+  name_table uniform_table_;
+
+  name_table attribute_table_;
+
+  std::vector<unsigned char> shadow_;
+
+  std::uint64_t upload_count_{};
+
+  std::uint64_t skip_count_{};
+};
+
+} // namespace glow
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace glow {
+
+/// @brief The instruction sets that the reduction kernels are written for.
+enum class simd_level
+{
+  scalar,
+  sse2,
+  avx2,
+  avx512,
+  neon,
+  wasm_simd128
+};
+
+/// @brief The smallest and largest of a set of values.
+///
+/// @note If there are no values, or they are all NaN, @c min is positive infinity and @c max is negative infinity.
+struct value_range final
+{
+  double min;
+
+  double max;
+};
+
+/// @brief Gets the smallest and largest of a column of values, skipping NaN.
+///
+/// @param stride The distance between values, in elements. Only contiguous columns (a stride of 1) are vectorized.
+auto
+reduce_min_max(const float* values, std::size_t count, std::size_t stride = 1) -> value_range;
+
+auto
+reduce_min_max(const double* values, std::size_t count, std::size_t stride = 1) -> value_range;
+
+auto
+reduce_min_max(const std::int16_t* values, std::size_t count, std::size_t stride = 1) -> value_range;
+
+/// @brief Gets the mean of a column of values, skipping NaN.
+///
+/// @return The mean, or NaN if there are no values other than NaN.
+auto
+reduce_mean(const float* values, std::size_t count, std::size_t stride = 1) -> double;
+
+auto
+reduce_mean(const double* values, std::size_t count, std::size_t stride = 1) -> double;
+
+auto
+reduce_mean(const std::int16_t* values, std::size_t count, std::size_t stride = 1) -> double;
+
+/// @brief Checks whether the kernels for an instruction set were built and can run on this machine.
+[[nodiscard]] auto
+is_simd_level_supported(simd_level level) -> bool;
+
+/// @brief Gets the instruction set used by the reductions.
+///
+/// @details The first time this is called (or a reduction is run), the best supported instruction set is picked.
+[[nodiscard]] auto
+get_simd_level() -> simd_level;
+
+/// @brief Changes the instruction set used by the reductions, for comparing them.
+///
+/// @note Throws @c std::invalid_argument if the instruction set is not supported.
+void
+set_simd_level(simd_level level);
+
+[[nodiscard]] auto
+get_simd_level_name(simd_level level) -> const char*;
+
+} // namespace glow
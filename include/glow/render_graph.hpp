@@ -0,0 +1,200 @@
+#pragma once
+
+#include <glow/framebuffer.hpp>
+#include <glow/framebuffer_pool.hpp>
+#include <glow/screen_quad.hpp>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <cstddef>
+
+namespace glow {
+
+/// @brief Schedules a set of render passes and the transient targets that connect them.
+///
+/// @details Passes declare which targets they read and write. When the graph is compiled, passes that do not
+///          contribute to an imported target (or that are not flagged as having side effects) are culled, the
+///          remaining passes are ordered by their dependencies, and transient targets whose lifetimes do not overlap
+///          are assigned to the same framebuffer.
+class render_graph final
+{
+public:
+  /// @brief A handle to a target within the graph.
+  using resource = std::size_t;
+
+  class builder;
+
+  class context;
+
+  explicit render_graph(framebuffer_pool& pool);
+
+  render_graph(const render_graph&) = delete;
+
+  render_graph(render_graph&&) = delete;
+
+  auto operator=(const render_graph&) -> render_graph& = delete;
+
+  auto operator=(render_graph&&) -> render_graph& = delete;
+
+  ~render_graph();
+
+  /// @brief Declares a target that only lives for the duration of the graph's execution.
+  [[nodiscard]] auto create_target(const char* name,
+                                   GLsizei width,
+                                   GLsizei height,
+                                   const framebuffer_format& format = {}) -> resource;
+
+  /// @brief Declares a target that is owned outside of the graph.
+  ///
+  /// @note Passes that write to imported targets are never culled.
+  [[nodiscard]] auto import_target(const char* name, framebuffer& target) -> resource;
+
+  /// @brief Declares the default framebuffer (the window surface) as a target of the graph.
+  [[nodiscard]] auto import_default_framebuffer(const char* name, GLsizei width, GLsizei height) -> resource;
+
+  /// @brief Adds a pass to the graph.
+  ///
+  /// @param setup Called immediately, in order to declare the targets that the pass reads and writes.
+  ///
+  /// @param execute Called from @ref render_graph::execute if the pass was not culled.
+  void add_pass(const char* name, const std::function<void(builder&)>& setup, std::function<void(context&)> execute);
+
+  /// @brief Culls and orders the passes and assigns framebuffers to the transient targets.
+  ///
+  /// @note This function throws a @c std::runtime_error if the passes contain a dependency cycle.
+  void compile();
+
+  /// @brief Executes the compiled passes.
+  ///
+  /// @note If the graph has been modified since it was last compiled, it gets compiled first.
+  void execute();
+
+  /// @brief Removes all passes and targets, so that the graph can be rebuilt.
+  void reset();
+
+  /// @brief Gets the number of passes that are executed after culling.
+  [[nodiscard]] auto active_pass_count() const -> std::size_t;
+
+  /// @brief Gets the number of passes that were culled.
+  [[nodiscard]] auto culled_pass_count() const -> std::size_t;
+
+  /// @brief Gets the number of framebuffers that back the transient targets.
+  [[nodiscard]] auto physical_target_count() const -> std::size_t;
+
+  /// @brief Gets the approximate amount of GPU memory used by the transient targets, in bytes.
+  [[nodiscard]] auto transient_memory_usage() const -> std::size_t;
+
+  /// @brief Gets the amount of GPU memory the transient targets would use if none of them were aliased, in bytes.
+  ///
+  /// @note Only the targets used by the passes that were not culled are counted, as of the last compile.
+  [[nodiscard]] auto unaliased_memory_usage() const -> std::size_t;
+
+private:
+  struct target_info final
+  {
+    std::string name;
+
+    GLsizei width{};
+
+    GLsizei height{};
+
+    framebuffer_format format;
+
+    framebuffer* imported{ nullptr };
+
+    bool is_default_framebuffer{ false };
+
+    /// @brief Whether the target is transient and used by a pass that was not culled, as of the last compile.
+    bool live{ false };
+
+    std::size_t physical_index{};
+  };
+
+  struct pass_info final
+  {
+    std::string name;
+
+    std::vector<resource> reads;
+
+    std::vector<resource> writes;
+
+    bool side_effects{ false };
+
+    bool active{ false };
+
+    std::function<void(context&)> execute;
+  };
+
+  struct physical_target final
+  {
+    GLsizei width{};
+
+    GLsizei height{};
+
+    framebuffer_format format;
+
+    framebuffer* target{ nullptr };
+  };
+
+  [[nodiscard]] auto is_transient(resource r) const -> bool;
+
+  framebuffer_pool* pool_{ nullptr };
+
+  screen_quad quad_;
+
+  std::vector<target_info> targets_;
+
+  std::vector<pass_info> passes_;
+
+  std::vector<std::size_t> order_;
+
+  std::vector<physical_target> physical_targets_;
+
+  bool compiled_{ false };
+};
+
+class render_graph::builder final
+{
+  render_graph* graph_{ nullptr };
+
+  std::size_t pass_{};
+
+public:
+  builder(render_graph& graph, std::size_t pass);
+
+  /// @brief Declares that the pass samples from the given target.
+  void read(resource r);
+
+  /// @brief Declares that the pass renders into the given target.
+  void write(resource r);
+
+  /// @brief Prevents the pass from being culled, even if nothing reads its outputs.
+  void set_side_effects(bool enabled = true);
+};
+
+class render_graph::context final
+{
+  render_graph* graph_{ nullptr };
+
+public:
+  explicit context(render_graph& graph);
+
+  /// @brief Binds the target for rendering and sets the viewport to cover it.
+  void bind(resource r);
+
+  /// @brief Gets the color texture of a target, for sampling.
+  ///
+  /// @note The default framebuffer has no texture, so zero is returned for it.
+  [[nodiscard]] auto texture(resource r) -> GLuint;
+
+  [[nodiscard]] auto width(resource r) const -> GLsizei;
+
+  [[nodiscard]] auto height(resource r) const -> GLsizei;
+
+  /// @brief Gets a quad that can be used to draw over the entire target.
+  [[nodiscard]] auto quad() -> screen_quad&;
+};
+
+} // namespace glow
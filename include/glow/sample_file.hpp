@@ -0,0 +1,170 @@
+#pragma once
+
+#include <implot.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace glow {
+
+class mapped_file;
+
+enum class sample_type : std::uint32_t
+{
+  float32 = 0,
+  float64 = 1,
+  int16 = 2
+};
+
+/// @brief Plots recordings that are too large to fit in memory, straight from a memory-mapped file.
+///
+/// @details A sample file is little-endian and starts with a 64 byte header:
+///
+///          | Offset | Type        | Contents                                         |
+///          |--------|-------------|--------------------------------------------------|
+///          | 0      | char[8]     | @c GLOWSMP1                                      |
+///          | 8      | uint32      | The @ref sample_type of the values               |
+///          | 12     | uint32      | The number of channels                           |
+///          | 16     | uint64      | The number of samples in each channel            |
+///          | 24     | float64     | The sample rate, in samples per unit of time     |
+///          | 32     | float64     | The time of the first sample                     |
+///          | 40     |             | Zero, up to offset 64                            |
+///
+///          The values follow the header, with all of the samples of the first channel, then all of the samples of
+///          the second one, and so on.
+///
+///          To draw any view quickly, an overview index is kept next to the file (with @c .overview appended to its
+///          name). It holds the minimum and maximum of each block of 1024 samples, then of each run of 16 blocks, and
+///          so on up to the whole file. It is built when the file is opened without one, or when the file was modified
+///          after it, which reads the whole file once. The index is mapped as well, so opening a file is cheap after
+///          that and the plot functions only touch the parts of the index, and of the samples, that are in view.
+///
+///          If the index cannot be written next to the file, it is built in memory instead, each time the file is
+///          opened.
+///
+/// @note On 32-bit platforms, including WebAssembly, the files must fit in the address space.
+class sample_file final
+{
+public:
+  /// @brief Opens a sample file, building its overview index if needed.
+  ///
+  /// @note Throws @c std::runtime_error if the file cannot be opened, or if it is not a valid sample file.
+  explicit sample_file(const std::string& path);
+
+  sample_file(const sample_file&) = delete;
+
+  sample_file(sample_file&&) = delete;
+
+  auto operator=(const sample_file&) -> sample_file& = delete;
+
+  auto operator=(sample_file&&) -> sample_file& = delete;
+
+  ~sample_file();
+
+  /// @brief Plots one channel as a line, reduced to the minimum and maximum of each pixel column.
+  ///
+  /// @note This must be called between @c ImPlot::BeginPlot and @c ImPlot::EndPlot.
+  void plot_line(const char* label, std::size_t channel, ImPlotLineFlags flags = 0);
+
+  /// @brief Shades the area between the minimum and maximum of each pixel column of one channel.
+  ///
+  /// @note This must be called between @c ImPlot::BeginPlot and @c ImPlot::EndPlot.
+  void plot_envelope(const char* label, std::size_t channel, ImPlotShadedFlags flags = 0);
+
+  /// @brief Gets a single sample.
+  [[nodiscard]] auto value(std::size_t channel, std::uint64_t index) const -> double;
+
+  /// @brief Gets the times of the first and last samples.
+  [[nodiscard]] auto time_range() const -> std::pair<double, double>;
+
+  [[nodiscard]] auto type() const -> sample_type;
+
+  [[nodiscard]] auto channels() const -> std::size_t;
+
+  /// @brief Gets the number of samples in each channel.
+  [[nodiscard]] auto size() const -> std::uint64_t;
+
+  [[nodiscard]] auto sample_rate() const -> double;
+
+  [[nodiscard]] auto start_time() const -> double;
+
+private:
+  struct range final
+  {
+    double min;
+
+    double max;
+  };
+
+  /// @brief The reduced points of a channel, kept until the view changes.
+  struct view_cache final
+  {
+    double x_min{};
+
+    double x_max{};
+
+    int width{};
+
+    bool valid{ false };
+
+    std::vector<double> starts;
+
+    std::vector<double> ends;
+
+    std::vector<double> mins;
+
+    std::vector<double> maxs;
+  };
+
+  [[nodiscard]] auto column(std::size_t channel) const -> const unsigned char*;
+
+  /// @brief Gets the overview entries of a level for a channel.
+  [[nodiscard]] auto level(std::size_t channel, std::size_t index) const -> const range*;
+
+  /// @brief Gets the extremes of each pixel column of a channel in the current plot.
+  auto update_view(std::size_t channel) -> const view_cache&;
+
+  /// @brief Opens the overview index, building it if it is missing or stale.
+  void open_overview(const std::string& path);
+
+  /// @brief Builds the overview index, passing each run of entries to a function along with its offset in the index.
+  template<typename Write>
+  void build_overview(Write write) const;
+
+  std::unique_ptr<mapped_file> file_;
+
+  std::unique_ptr<mapped_file> overview_file_;
+
+  /// @brief The overview index, when it could not be written to disk.
+  std::vector<unsigned char> overview_memory_;
+
+  const unsigned char* overview_{ nullptr };
+
+  /// @brief The offset of each level in the overview index, in entries, relative to the start of a channel's levels.
+  std::vector<std::uint64_t> level_offsets_;
+
+  std::uint64_t entries_per_channel_{};
+
+  sample_type type_{ sample_type::float32 };
+
+  std::size_t channels_{};
+
+  std::uint64_t size_{};
+
+  double sample_rate_{ 1.0 };
+
+  double start_time_{};
+
+  std::vector<view_cache> views_;
+
+  std::vector<double> xs_;
+
+  std::vector<double> ys_;
+};
+
+} // namespace glow
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <glow/framebuffer.hpp>
+#include <glow/gpu_timer.hpp>
+#include <glow/screen_quad.hpp>
+
+#include <imgui.h>
+
+#include <memory>
+
+namespace glow {
+
+enum class upscale_filter
+{
+  bilinear,
+  /// @brief Bilinear filtering, followed by an unsharp mask to recover some of the lost detail.
+  sharpen
+};
+
+struct scaled_viewport_config final
+{
+  /// @brief The GPU time, in milliseconds, that the scene should take to render.
+  float target_ms{ 8.0f };
+
+  float min_scale{ 0.25f };
+
+  float max_scale{ 1.0f };
+
+  /// @brief How quickly the scale moves toward its ideal value, between zero and one.
+  float adjust_rate{ 0.1f };
+
+  upscale_filter filter{ upscale_filter::sharpen };
+
+  /// @brief The strength of the sharpening filter, between zero and one.
+  float sharpness{ 0.25f };
+
+  /// @brief Whether or not the scene gets a depth buffer.
+  bool depth{ true };
+};
+
+/// @brief An ImGui panel that the application renders a scene into, at a resolution that adapts to the GPU load.
+///
+/// @details The scene is rendered into an offscreen framebuffer at a fraction of the panel's size. The fraction is
+///          adjusted every frame, based on the measured GPU time of the scene, so that it stays within the frame
+///          budget. The result is then upscaled to the panel's size with a filter shader and shown with
+///          @c ImGui::Image. Without GPU timer queries, the scale stays at the maximum.
+class scaled_viewport final
+{
+public:
+  explicit scaled_viewport(const scaled_viewport_config& cfg = scaled_viewport_config{});
+
+  scaled_viewport(const scaled_viewport&) = delete;
+
+  scaled_viewport(scaled_viewport&&) = delete;
+
+  auto operator=(const scaled_viewport&) -> scaled_viewport& = delete;
+
+  auto operator=(scaled_viewport&&) -> scaled_viewport& = delete;
+
+  ~scaled_viewport();
+
+  /// @brief Prepares the scene framebuffer for rendering.
+  ///
+  /// @details This should be called within an ImGui window. On success, the scene framebuffer is bound and the
+  ///          viewport is set to the current render resolution, which is available from @ref scaled_viewport::width
+  ///          and @ref scaled_viewport::height.
+  ///
+  /// @param size The size of the panel. Components that are zero or less take up the remaining content region.
+  ///
+  /// @return True if the scene should be rendered, in which case @ref scaled_viewport::end must be called.
+  auto begin(ImVec2 size = ImVec2(0, 0)) -> bool;
+
+  /// @brief Upscales the scene into the panel and adds it to the current ImGui window.
+  void end();
+
+  void set_config(const scaled_viewport_config& cfg);
+
+  [[nodiscard]] auto get_config() const -> const scaled_viewport_config&;
+
+  /// @brief Gets the current render width of the scene.
+  [[nodiscard]] auto width() const -> GLsizei;
+
+  /// @brief Gets the current render height of the scene.
+  [[nodiscard]] auto height() const -> GLsizei;
+
+  /// @brief Gets the current fraction of the panel size that the scene is rendered at.
+  [[nodiscard]] auto scale() const -> float;
+
+  /// @brief Gets the last measured frame time of the scene, in milliseconds.
+  ///
+  /// @note When GPU timer queries are unavailable, this stays at zero and the scale is not adjusted.
+  [[nodiscard]] auto frame_ms() const -> float;
+
+private:
+  void update_scale();
+
+  scaled_viewport_config config_;
+
+  std::unique_ptr<framebuffer> scene_;
+
+  std::unique_ptr<framebuffer> display_;
+
+  screen_quad quad_;
+
+  gpu_timer timer_;
+
+  GLuint program_{};
+
+  GLint source_location_{ -1 };
+
+  GLint uv_scale_location_{ -1 };
+
+  GLint texel_size_location_{ -1 };
+
+  GLint sharpness_location_{ -1 };
+
+  float scale_{ 1.0f };
+
+  float frame_ms_{ 0.0f };
+
+  GLsizei panel_width_{};
+
+  GLsizei panel_height_{};
+
+  GLsizei width_{};
+
+  GLsizei height_{};
+};
+
+} // namespace glow
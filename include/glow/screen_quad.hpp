@@ -10,6 +10,10 @@ class screen_quad final
 
   GLuint vertex_array_{};
 
+  GLuint empty_vertex_array_{};
+
+  GLint position_attrib_{ 0 };
+
 public:
   screen_quad();
 
@@ -23,7 +27,19 @@ public:
 
   auto operator=(screen_quad&&) -> screen_quad& = delete;
 
+  /// @brief Draws two triangles covering the viewport, with the corner positions fed to the given attribute.
   void draw(GLint position_attrib);
+
+  /// @brief Draws a single triangle that covers the viewport, without any vertex attributes.
+  ///
+  /// @details The vertex shader is expected to derive the position from @c gl_VertexID, which requires GLSL ES 3.00.
+  ///          See @ref screen_quad::fullscreen_vertex_shader for a shader that does this.
+  void draw_triangle();
+
+  /// @brief A GLSL ES 3.00 vertex shader (without the version line) for use with @ref screen_quad::draw_triangle.
+  ///
+  /// @details It outputs @c texcoord, which ranges from zero to one across the viewport.
+  static const char* const fullscreen_vertex_shader;
 };
 
 } // namespace glow
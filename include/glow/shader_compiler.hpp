@@ -2,6 +2,7 @@
 
 #include <GLES3/gl3.h>
 
+#include <exception>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -33,6 +34,18 @@ public:
   using shader_error::shader_error;
 };
 
+/// @brief The GLSL version that gets prepended to shader sources.
+enum class shader_version
+{
+  /// @brief GLSL ES 1.00, for OpenGL ES 2.0 and WebGL.
+  es_100,
+  /// @brief GLSL ES 3.00, for OpenGL ES 3.0 and WebGL 2.
+  ///
+  /// @note A default float precision of @c highp is added after any @c #extension directives at the start of the
+  ///       source.
+  es_300
+};
+
 /**
  * @brief Compiles a vertex and fragment shader into a single program.
  *
@@ -40,11 +53,128 @@ public:
  *
  * @param defines A series of definitions to prepend to each shader string.
  *
+ * @param version The GLSL version to declare at the top of each shader string.
+ *
  * @note This function will throw an exception if an error occurs.
  * */
 GLuint
 compile_shader(const char* vert_source,
                const char* frag_source,
-               const std::vector<std::pair<std::string, std::string>>& defines);
+               const std::vector<std::pair<std::string, std::string>>& defines,
+               shader_version version = shader_version::es_100);
+
+/**
+ * @brief Assigns a uniform block of a program to a uniform buffer binding point.
+ *
+ * @details Uniform blocks require @ref shader_version::es_300. Buffers bound to the binding point with
+ *          @c glBindBufferRange (see @ref uniform_ring) then supply the block's values.
+ *
+ * @return False if the program has no active block with the given name.
+ * */
+auto
+bind_uniform_block(GLuint program, const char* block_name, GLuint binding) -> bool;
+
+/**
+ * @brief A program that is being compiled in the background.
+ *
+ * @details Jobs are created with @ref compile_shader_async. Call @ref shader_job::poll once per frame until it returns
+ *          true, then call @ref shader_job::get to take the program (or the error).
+ * */
+class shader_job final
+{
+public:
+  shader_job() = default;
+
+  shader_job(const shader_job&) = delete;
+
+  shader_job(shader_job&& other) noexcept;
+
+  auto operator=(const shader_job&) -> shader_job& = delete;
+
+  auto operator=(shader_job&& other) noexcept -> shader_job&;
+
+  /// @note If the program was never taken with @ref shader_job::get, it is deleted.
+  ~shader_job();
+
+  /// @brief Checks whether the program has finished compiling and linking.
+  ///
+  /// @details With @c GL_KHR_parallel_shader_compile, this never blocks. Without it, the status queries are deferred
+  ///          until the job has been polled once, giving the driver a frame to work on it before the query forces it
+  ///          to finish.
+  ///
+  /// @return True if @ref shader_job::get can be called without blocking.
+  auto poll() -> bool;
+
+  /// @brief Indicates whether the job has finished, either successfully or with an error.
+  [[nodiscard]] auto done() const -> bool;
+
+  /// @brief Takes the linked program, blocking if it is not done yet.
+  ///
+  /// @return The ID of the linked program. The caller becomes responsible for deleting it.
+  ///
+  /// @note This throws a @ref shader_compile_error or @ref shader_link_error if the program failed to build.
+  auto get() -> GLuint;
+
+private:
+  friend auto compile_shader_async(const char*,
+                                   const char*,
+                                   const std::vector<std::pair<std::string, std::string>>&,
+                                   shader_version) -> shader_job;
+
+  void finish();
+
+  void release();
+
+  GLuint vert_id_{};
+
+  GLuint frag_id_{};
+
+  GLuint program_id_{};
+
+  std::string vert_source_;
+
+  std::string frag_source_;
+
+  std::string cache_path_;
+
+  std::exception_ptr error_;
+
+  bool parallel_{ false };
+
+  bool done_{ false };
+
+  bool taken_{ false };
+
+  unsigned int poll_count_{};
+};
+
+/**
+ * @brief Starts compiling a vertex and fragment shader into a single program, without waiting for the result.
+ *
+ * @details This takes the same arguments as @ref compile_shader. If the program is found in the binary cache, the
+ *          returned job is already done.
+ * */
+auto
+compile_shader_async(const char* vert_source,
+                     const char* frag_source,
+                     const std::vector<std::pair<std::string, std::string>>& defines,
+                     shader_version version = shader_version::es_100) -> shader_job;
+
+/**
+ * @brief Enables the persistent cache of linked program binaries.
+ *
+ * @details When enabled, @ref compile_shader looks for a binary of the program in this directory before compiling it
+ *          from source, and stores the binary after a successful link. Entries are keyed by the sources, the defines,
+ *          the GLSL version, the GL renderer and version strings, and the glow version. If the driver rejects an
+ *          entry, the program is compiled from source and the entry is replaced.
+ *
+ * @param path The directory to store the cache entries in. It must already exist. Passing an empty string disables the
+ *             cache, which is the default.
+ * */
+void
+set_shader_cache_directory(const std::string& path);
+
+auto
+get_shader_cache_directory() -> const std::string&;
 
 } // namespace glow
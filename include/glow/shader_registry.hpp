@@ -0,0 +1,107 @@
+#pragma once
+
+#include <glow/shader_compiler.hpp>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace glow {
+
+/// @brief Keeps track of programs that are compiled from shader files and recompiles them when the files change.
+///
+/// @details On Linux, the files are watched with inotify. On other platforms, their modification times are checked
+///          when the registry is polled. Changed programs are recompiled with @ref compile_shader_async, so a reload
+///          is spread over several frames instead of stalling one. If a reload fails, the last program that compiled
+///          successfully stays in place and the error is kept, so that it can be shown with
+///          @ref shader_registry::render_overlay.
+class shader_registry final
+{
+public:
+  using handle = std::size_t;
+
+  using defines = std::vector<std::pair<std::string, std::string>>;
+
+  shader_registry();
+
+  shader_registry(const shader_registry&) = delete;
+
+  shader_registry(shader_registry&&) = delete;
+
+  auto operator=(const shader_registry&) -> shader_registry& = delete;
+
+  auto operator=(shader_registry&&) -> shader_registry& = delete;
+
+  ~shader_registry();
+
+  /// @brief Adds a program to the registry and compiles it.
+  ///
+  /// @note If the initial compilation fails, the error is recorded and the program is zero until the files are fixed.
+  auto add(const std::string& vert_path,
+           const std::string& frag_path,
+           const defines& defs = {},
+           shader_version version = shader_version::es_100) -> handle;
+
+  /// @brief Gets the most recent program that compiled successfully, or zero if there is none.
+  [[nodiscard]] auto program(handle h) const -> GLuint;
+
+  /// @brief Gets a counter that is incremented every time the program is replaced.
+  ///
+  /// @details This can be used to know when to look up uniform locations again.
+  [[nodiscard]] auto generation(handle h) const -> std::uint64_t;
+
+  /// @brief Gets the error from the last compilation of a program, or an empty string if it succeeded.
+  [[nodiscard]] auto error(handle h) const -> const std::string&;
+
+  /// @brief Indicates whether any program currently has an error.
+  [[nodiscard]] auto has_errors() const -> bool;
+
+  /// @brief Checks for changed files and advances any reloads that are in progress.
+  ///
+  /// @param max_pending The maximum number of programs that may be compiling at once.
+  void poll(std::size_t max_pending = 2);
+
+  /// @brief Marks a program as changed, as if one of its files had been modified.
+  void reload(handle h);
+
+  /// @brief Shows the current compilation errors in an ImGui window, if there are any.
+  void render_overlay();
+
+private:
+  struct entry final
+  {
+    std::string vert_path;
+
+    std::string frag_path;
+
+    defines defs;
+
+    shader_version version{};
+
+    GLuint program{};
+
+    std::uint64_t generation{};
+
+    std::string error;
+
+    bool dirty{ false };
+
+    std::unique_ptr<shader_job> job;
+  };
+
+  class watcher;
+
+  void start(entry& e);
+
+  void complete(entry& e);
+
+  std::vector<entry> entries_;
+
+  std::unique_ptr<watcher> watcher_;
+};
+
+} // namespace glow
@@ -0,0 +1,205 @@
+#pragma once
+
+#include <glow/shader_compiler.hpp>
+
+#include <array>
+#include <initializer_list>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace glow {
+
+struct shader_variant_stats final
+{
+  /// @brief The number of variants compiled so far, including ones that were later evicted.
+  std::size_t compile_count{};
+
+  /// @brief The number of variants evicted so far.
+  std::size_t eviction_count{};
+
+  /// @brief The number of variants currently compiled.
+  std::size_t resident_count{};
+
+  /// @brief The time spent compiling variants, in milliseconds.
+  double total_compile_ms{};
+
+  /// @brief The longest time spent compiling a single variant, in milliseconds.
+  double max_compile_ms{};
+};
+
+/// @brief Compiles permutations of a single shader source pair on demand and keeps them around until evicted.
+///
+/// @details Variants are identified by a 64-bit key chosen by the caller. Most code should use the typed
+///          @ref shader_variants wrapper instead of using this class directly.
+class shader_variant_cache final
+{
+public:
+  using defines = std::vector<std::pair<std::string, std::string>>;
+
+  shader_variant_cache(std::string vert_source, std::string frag_source, shader_version version);
+
+  shader_variant_cache(const shader_variant_cache&) = delete;
+
+  shader_variant_cache(shader_variant_cache&&) = delete;
+
+  auto operator=(const shader_variant_cache&) -> shader_variant_cache& = delete;
+
+  auto operator=(shader_variant_cache&&) -> shader_variant_cache& = delete;
+
+  ~shader_variant_cache();
+
+  /// @brief Looks up a variant that has already been compiled.
+  ///
+  /// @return The program of the variant, or zero if it has not been compiled.
+  auto find(std::uint64_t key) -> GLuint;
+
+  /// @brief Compiles a variant and adds it to the cache.
+  ///
+  /// @note This throws a @ref shader_error if the variant fails to compile.
+  auto insert(std::uint64_t key, const defines& defs) -> GLuint;
+
+  /// @brief Advances the frame counter that is used to find rarely used variants.
+  void next_frame();
+
+  /// @brief Deletes the variants that have not been used within the given number of frames.
+  void evict_unused(std::uint32_t max_idle_frames);
+
+  /// @brief Sets the maximum number of variants to keep compiled. Zero means there is no limit.
+  ///
+  /// @details When inserting a variant would exceed the limit, the least recently used variant is deleted. Variants
+  ///          used in the current frame are never deleted, so the limit can be exceeded until the next frame.
+  void set_capacity(std::size_t capacity);
+
+  /// @brief Deletes all variants.
+  void clear();
+
+  [[nodiscard]] auto stats() const -> const shader_variant_stats&;
+
+private:
+  struct variant final
+  {
+    GLuint program{};
+
+    std::uint64_t last_used_frame{};
+  };
+
+  void evict(std::unordered_map<std::uint64_t, variant>::iterator it);
+
+  std::string vert_source_;
+
+  std::string frag_source_;
+
+  shader_version version_{};
+
+  std::unordered_map<std::uint64_t, variant> variants_;
+
+  std::uint64_t frame_{};
+
+  std::size_t capacity_{};
+
+  shader_variant_stats stats_;
+};
+
+/// @brief A set of features, declared as an enumeration, that select a shader variant.
+///
+/// @tparam Feature An enumeration whose values are zero-based indices of the features.
+template<typename Feature, std::size_t FeatureCount>
+class feature_set final
+{
+  static_assert(FeatureCount <= 64, "A shader can have at most 64 features.");
+
+  std::uint64_t bits_{};
+
+public:
+  constexpr feature_set() = default;
+
+  constexpr feature_set(std::initializer_list<Feature> features)
+  {
+    for (const auto f : features) {
+      set(f);
+    }
+  }
+
+  constexpr auto set(const Feature f, const bool enabled = true) -> feature_set&
+  {
+    const auto mask = std::uint64_t{ 1 } << static_cast<std::size_t>(f);
+    bits_ = enabled ? (bits_ | mask) : (bits_ & ~mask);
+    return *this;
+  }
+
+  [[nodiscard]] constexpr auto test(const Feature f) const -> bool
+  {
+    return ((bits_ >> static_cast<std::size_t>(f)) & 1) != 0;
+  }
+
+  [[nodiscard]] constexpr auto bits() const -> std::uint64_t { return bits_; }
+};
+
+/// @brief Lazily compiles the permutations of a shader that are selected by a fixed set of feature flags.
+///
+/// @details Each feature is mapped to a preprocessor definition, which is set to 1 when the feature is enabled and 0
+///          otherwise. A permutation is compiled the first time it is requested.
+///
+///          @code
+///          enum class material_feature { normal_map, skinning, fog };
+///
+///          glow::shader_variants<material_feature, 3> variants(vert, frag, { "NORMAL_MAP", "SKINNING", "FOG" });
+///
+///          GLuint program = variants.get({ material_feature::fog });
+///          @endcode
+template<typename Feature, std::size_t FeatureCount>
+class shader_variants final
+{
+public:
+  using features = feature_set<Feature, FeatureCount>;
+
+  using feature_names = std::array<const char*, FeatureCount>;
+
+  shader_variants(const char* vert_source,
+                  const char* frag_source,
+                  const feature_names& names,
+                  const shader_version version = shader_version::es_100)
+    : names_(names)
+    , cache_(vert_source, frag_source, version)
+  {
+  }
+
+  /// @brief Gets the program for a permutation, compiling it if needed.
+  ///
+  /// @note This throws a @ref shader_error if the permutation fails to compile.
+  auto get(const features f) -> GLuint
+  {
+    const auto key = f.bits();
+
+    const auto program = cache_.find(key);
+    if (program != 0) {
+      return program;
+    }
+
+    shader_variant_cache::defines defs;
+
+    defs.reserve(FeatureCount);
+
+    for (std::size_t i = 0; i < FeatureCount; i++) {
+      defs.emplace_back(names_[i], f.test(static_cast<Feature>(i)) ? "1" : "0");
+    }
+
+    return cache_.insert(key, defs);
+  }
+
+  [[nodiscard]] auto cache() -> shader_variant_cache& { return cache_; }
+
+  [[nodiscard]] auto stats() const -> const shader_variant_stats& { return cache_.stats(); }
+
+private:
+  feature_names names_;
+
+  shader_variant_cache cache_;
+};
+
+} // namespace glow
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <glow/framebuffer.hpp>
+#include <glow/screen_quad.hpp>
+#include <glow/shader_compiler.hpp>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+
+namespace glow {
+
+/// @brief Compiles a known set of programs across several frames, before they are first used.
+///
+/// @details Programs are usually listed in a manifest file, one per line:
+///
+///          @code
+///          # keyword  name  vertex shader  fragment shader  options
+///          program    mesh  mesh.vert      mesh.frag        es300 USE_FOG=1 MAX_LIGHTS=4
+///          @endcode
+///
+///          Paths are relative to the directory of the manifest. The optional @c es300 token selects GLSL ES 3.00, and
+///          the remaining tokens are definitions. Blank lines and lines starting with @c # are ignored.
+///
+///          Every program is drawn once, with a single triangle into a 1x1 framebuffer, after it links. Many drivers
+///          finish compiling a program only when it is first drawn with, so this moves that cost out of the first frame
+///          that actually uses the program.
+class shader_warmup final
+{
+public:
+  using defines = std::vector<std::pair<std::string, std::string>>;
+
+  shader_warmup();
+
+  shader_warmup(const shader_warmup&) = delete;
+
+  shader_warmup(shader_warmup&&) = delete;
+
+  auto operator=(const shader_warmup&) -> shader_warmup& = delete;
+
+  auto operator=(shader_warmup&&) -> shader_warmup& = delete;
+
+  ~shader_warmup();
+
+  /// @brief Reads a manifest and queues each of its programs.
+  ///
+  /// @note This throws a @c std::runtime_error if a file cannot be read or a line cannot be parsed.
+  void load_manifest(const std::string& path);
+
+  /// @brief Queues a program to be compiled from source.
+  void add(const std::string& name,
+           std::string vert_source,
+           std::string frag_source,
+           const defines& defs = {},
+           shader_version version = shader_version::es_100);
+
+  /// @brief Does as much work as fits within the time budget.
+  ///
+  /// @return True if all queued programs are done.
+  auto step(float budget_ms) -> bool;
+
+  [[nodiscard]] auto done() const -> bool;
+
+  /// @brief Gets the fraction of queued programs that are done, between zero and one.
+  [[nodiscard]] auto progress() const -> float;
+
+  /// @brief Gets a program by the name it was queued with.
+  ///
+  /// @return The program, or zero if it does not exist, failed to compile, or is not done yet. It remains owned by
+  ///         this object.
+  [[nodiscard]] auto program(const std::string& name) const -> GLuint;
+
+  /// @brief Gets the errors of the programs that failed to compile, as pairs of names and messages.
+  [[nodiscard]] auto errors() const -> std::vector<std::pair<std::string, std::string>>;
+
+  /// @brief Shows a centered progress bar with ImGui.
+  void render_progress();
+
+private:
+  struct entry final
+  {
+    std::string name;
+
+    std::string vert_source;
+
+    std::string frag_source;
+
+    defines defs;
+
+    shader_version version{};
+
+    std::unique_ptr<shader_job> job;
+
+    GLuint program{};
+
+    std::string error;
+
+    bool done{ false };
+  };
+
+  void start(entry& e);
+
+  void finish(entry& e);
+
+  void draw_once(GLuint program);
+
+  std::vector<entry> entries_;
+
+  std::unordered_map<std::string, std::size_t> names_;
+
+  std::size_t next_{};
+
+  std::size_t done_count_{};
+
+  std::unique_ptr<framebuffer> target_;
+
+  std::unique_ptr<screen_quad> quad_;
+};
+
+} // namespace glow
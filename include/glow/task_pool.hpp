@@ -0,0 +1,99 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace glow {
+
+/// @brief A fixed set of worker threads that run batches of independent tasks.
+///
+/// @details A batch is a number of tasks, each identified by its index, that are all run by the same function. Tasks
+///          are handed out one index at a time, so tasks that take different amounts of time still balance across the
+///          threads. The thread that waits on a batch runs tasks as well, until there are none left.
+///
+///          Only one batch is run at a time, and a pool should only be used from one thread.
+///
+/// @note On WebAssembly builds without thread support, there are no worker threads and all of the tasks are run when
+///       the batch is waited on.
+class task_pool final
+{
+public:
+  using task = std::function<void(std::size_t index)>;
+
+  /// @param threads The number of worker threads. Zero picks one less than the number of hardware threads, since the
+  ///                thread waiting on a batch also runs its tasks.
+  explicit task_pool(std::size_t threads = 0);
+
+  task_pool(const task_pool&) = delete;
+
+  task_pool(task_pool&&) = delete;
+
+  auto operator=(const task_pool&) -> task_pool& = delete;
+
+  auto operator=(task_pool&&) -> task_pool& = delete;
+
+  ~task_pool();
+
+  /// @brief Starts running a batch of tasks, without waiting for them.
+  ///
+  /// @details If a batch is already running, it is waited on first.
+  void start(std::size_t count, task func);
+
+  /// @brief Waits for the running batch to finish, running its tasks on the calling thread in the meantime.
+  ///
+  /// @note If any of the tasks threw an exception, the first one is thrown again from here.
+  void wait();
+
+  /// @brief Runs a batch of tasks and waits for them.
+  void run(std::size_t count, task func);
+
+  /// @brief Gets whether a batch was started and not waited on yet.
+  [[nodiscard]] auto busy() const -> bool;
+
+  /// @brief Gets the number of worker threads, not counting the one that waits on a batch.
+  [[nodiscard]] auto thread_count() const -> std::size_t;
+
+private:
+  void work();
+
+  /// @brief Runs the tasks of the current batch until there are none left to take.
+  void run_tasks();
+
+  std::vector<std::thread> threads_;
+
+  std::mutex mutex_;
+
+  /// @brief Signals the workers that a batch was started, or that the pool is being destroyed.
+  std::condition_variable start_signal_;
+
+  /// @brief Signals the waiting thread that the last worker left the batch.
+  std::condition_variable done_signal_;
+
+  task func_;
+
+  std::size_t count_{};
+
+  std::atomic<std::size_t> next_{};
+
+  /// @brief Incremented each time a batch is started, so that each worker joins a batch once.
+  std::uint64_t generation_{};
+
+  /// @brief The number of workers running tasks of the current batch.
+  std::size_t active_{};
+
+  std::exception_ptr error_;
+
+  bool busy_{ false };
+
+  bool stopping_{ false };
+};
+
+} // namespace glow
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <implot.h>
+
+#include <deque>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+
+namespace glow {
+
+/// @brief Stores timestamped samples for long-running plots, along with a min/max pyramid for drawing them quickly.
+///
+/// @details Samples are kept in fixed-size chunks, with the times and each channel stored in separate columns. Each
+///          chunk also keeps, for each channel, the minimum and maximum of every aligned run of 8, 16, 32 and so on
+///          samples, up to the whole chunk. These are updated as samples are appended, and take about a quarter of the
+///          memory of the samples.
+///
+///          When plotting, the level of the pyramid is picked so that each pixel column covers about one entry, which
+///          makes the cost of drawing proportional to the width of the plot instead of the number of samples in view.
+///          Only when zoomed out past the size of a chunk are several chunk summaries merged per pixel.
+///
+/// @note Times must not decrease from one sample to the next.
+class time_series final
+{
+public:
+  /// @param channels The number of values in each sample.
+  ///
+  /// @param chunk_size The number of samples in each chunk, which must be a power of two and at least 8.
+  explicit time_series(std::size_t channels, std::size_t chunk_size = 4096);
+
+  time_series(const time_series&) = delete;
+
+  time_series(time_series&&) = delete;
+
+  auto operator=(const time_series&) -> time_series& = delete;
+
+  auto operator=(time_series&&) -> time_series& = delete;
+
+  ~time_series() = default;
+
+  /// @brief Appends one sample.
+  ///
+  /// @param values One value for each channel.
+  void append(double time, const double* values);
+
+  /// @brief Appends a block of samples.
+  ///
+  /// @param values The values of each sample, one after the other, with one value for each channel.
+  void append(const double* times, const double* values, std::size_t count);
+
+  /// @brief Discards the chunks whose samples are all older than the given time.
+  ///
+  /// @note Since whole chunks are discarded, up to one chunk of older samples may be kept.
+  void discard_before(double time);
+
+  void clear();
+
+  /// @brief Plots one channel as a line, reduced to the minimum and maximum of each pixel column.
+  ///
+  /// @note This must be called between @c ImPlot::BeginPlot and @c ImPlot::EndPlot.
+  void plot_line(const char* label, std::size_t channel, ImPlotLineFlags flags = 0);
+
+  /// @brief Shades the area between the minimum and maximum of each pixel column of one channel.
+  ///
+  /// @note This must be called between @c ImPlot::BeginPlot and @c ImPlot::EndPlot.
+  void plot_envelope(const char* label, std::size_t channel, ImPlotShadedFlags flags = 0);
+
+  /// @brief Gets the times of the oldest and newest samples.
+  [[nodiscard]] auto time_range() const -> std::pair<double, double>;
+
+  [[nodiscard]] auto size() const -> std::size_t;
+
+  [[nodiscard]] auto channels() const -> std::size_t;
+
+  [[nodiscard]] auto chunk_size() const -> std::size_t;
+
+private:
+  struct range final
+  {
+    double min;
+
+    double max;
+  };
+
+  struct chunk final
+  {
+    std::vector<double> times;
+
+    /// @brief The values of each channel, one channel after another.
+    std::vector<double> values;
+
+    /// @brief The pyramid of each channel, one channel after another, with the finest level first.
+    std::vector<range> levels;
+
+    std::size_t size{};
+  };
+
+  /// @brief Updates the pyramid of a channel after samples were appended to a chunk, starting at the given sample.
+  void update_pyramid(chunk& c, std::size_t channel, std::size_t first) const;
+
+  [[nodiscard]] auto time_at(std::size_t index) const -> double;
+
+  /// @brief Gets the minimum and maximum of an entry in a level of the pyramid, where level 0 is the samples.
+  ///
+  /// @note Levels between 0 and the finest level kept in the pyramid cannot be read.
+  [[nodiscard]] auto entry(std::size_t channel, std::size_t level, std::size_t index) const -> range;
+
+  /// @brief Fills the group buffers with the extremes of each pixel column in the current plot.
+  void build_groups(std::size_t channel);
+
+  std::deque<chunk> chunks_;
+
+  std::size_t channels_{};
+
+  std::size_t chunk_size_{};
+
+  /// @brief The number of levels above the samples, with the last one covering a whole chunk.
+  std::size_t level_count_{};
+
+  std::vector<double> group_starts_;
+
+  std::vector<double> group_ends_;
+
+  std::vector<double> group_mins_;
+
+  std::vector<double> group_maxs_;
+
+  std::vector<double> xs_;
+
+  std::vector<double> ys_;
+};
+
+} // namespace glow
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <GLES3/gl3.h>
+
+#include <vector>
+
+#include <cstddef>
+
+namespace glow {
+
+/// @brief A range of a @ref uniform_ring that holds one block of constants.
+struct uniform_allocation final
+{
+  std::size_t offset{};
+
+  std::size_t size{};
+};
+
+/// @brief Sub-allocates per-draw uniform blocks from one large uniform buffer per frame in flight.
+///
+/// @details Constants are pushed into a CPU-side staging area, uploaded with a single call, and then bound for each
+///          draw with @c glBindBufferRange. Each frame in flight has its own buffer, guarded by a fence, so the CPU
+///          never overwrites constants the GPU is still reading. A typical frame looks like this:
+///
+///          @code
+///          ring.begin_frame();
+///          for (auto& obj : objects) obj.constants = ring.push(obj.data);
+///          ring.upload();
+///          for (auto& obj : objects) { ring.bind(0, obj.constants); obj.draw(); }
+///          ring.end_frame();
+///          @endcode
+///
+///          Shaders must be compiled with @ref shader_version::es_300 and have their blocks assigned to a binding point
+///          with @ref bind_uniform_block.
+class uniform_ring final
+{
+public:
+  /// @param frame_size The number of bytes available to each frame.
+  ///
+  /// @param frames_in_flight The number of frames the GPU may lag behind the CPU.
+  explicit uniform_ring(std::size_t frame_size, std::size_t frames_in_flight = 3);
+
+  uniform_ring(const uniform_ring&) = delete;
+
+  uniform_ring(uniform_ring&&) = delete;
+
+  auto operator=(const uniform_ring&) -> uniform_ring& = delete;
+
+  auto operator=(uniform_ring&&) -> uniform_ring& = delete;
+
+  ~uniform_ring();
+
+  /// @brief Moves to the next buffer, waiting for the GPU to finish with it if needed.
+  void begin_frame();
+
+  /// @brief Copies a block of constants into the staging area.
+  ///
+  /// @note This throws a @c std::length_error if the frame has run out of space.
+  auto push(const void* data, std::size_t size) -> uniform_allocation;
+
+  template<typename T>
+  auto push(const T& block) -> uniform_allocation
+  {
+    return push(&block, sizeof(T));
+  }
+
+  /// @brief Uploads everything pushed since the last upload.
+  void upload();
+
+  /// @brief Binds a block of constants to a uniform buffer binding point.
+  void bind(GLuint binding, const uniform_allocation& allocation);
+
+  /// @brief Marks the point after which the GPU is done with the current buffer.
+  void end_frame();
+
+  /// @brief Gets the number of bytes pushed in the current frame, including alignment padding.
+  [[nodiscard]] auto used() const -> std::size_t;
+
+  [[nodiscard]] auto capacity() const -> std::size_t;
+
+private:
+  struct frame final
+  {
+    GLuint buffer{};
+
+    GLsync fence{};
+  };
+
+  std::vector<frame> frames_;
+
+  std::vector<unsigned char> staging_;
+
+  std::size_t current_{};
+
+  std::size_t offset_{};
+
+  std::size_t uploaded_{};
+
+  std::size_t alignment_{ 256 };
+};
+
+} // namespace glow
@@ -2,12 +2,18 @@
 
 #include <glad/glad.h>
 
+#include <glow/gl_state.hpp>
+#include <glow/gl_stats.hpp>
+#include <glow/shader_compiler.hpp>
+
 #include <pybind11/stl.h>
 
-#include <string_view>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 #include <cstddef>
+#include <cstdint>
 
 namespace glow::python {
 
@@ -15,10 +21,19 @@ namespace {
 
 namespace py = pybind11;
 
+/// @brief Raises an error if the context is older than OpenGL ES 3.0, whose entry points are null on such contexts.
+void
+require_es3(const char* what)
+{
+  if (!GLAD_GL_ES_VERSION_3_0) {
+    throw std::runtime_error(std::string(what) + " requires an OpenGL ES 3.0 context.");
+  }
+}
+
 void
 viewport(GLint x, GLint y, GLsizei w, GLsizei h)
 {
-  glViewport(x, y, w, h);
+  gl_state::current().viewport(x, y, w, h);
 }
 
 void
@@ -66,9 +81,12 @@ gen_textures(std::size_t n) -> std::vector<gl_texture>
 void
 delete_textures(const std::vector<gl_texture>& textures)
 {
+  auto& state = gl_state::current();
+
   std::vector<GLuint> ids(textures.size());
   for (std::size_t i = 0; i < textures.size(); i++) {
     ids[i] = textures[i].id;
+    state.forget_texture(ids[i]);
   }
 
   glDeleteTextures(static_cast<GLsizei>(ids.size()), ids.data());
@@ -89,7 +107,7 @@ enum class TextureTarget : GLenum
 void
 bind_texture(TextureTarget target, const gl_texture& tex)
 {
-  glBindTexture(static_cast<GLenum>(target), tex.id);
+  gl_state::current().bind_texture(static_cast<GLenum>(target), tex.id);
 }
 
 enum class TextureIntParameter
@@ -146,6 +164,162 @@ enum class TexelType : GLenum
   UnsignedShort5551 = GL_UNSIGNED_SHORT_5_5_5_1
 };
 
+/// @brief Gets the number of bytes per pixel for the formats and types exposed to Python.
+auto
+pixel_size(TextureFormat format, TexelType type) -> std::size_t
+{
+  if (type != TexelType::UnsignedByte) {
+    // The packed types hold a whole pixel in 16 bits.
+    return 2;
+  }
+
+  switch (format) {
+    case TextureFormat::Alpha:
+    case TextureFormat::Luminance:
+      return 1;
+    case TextureFormat::LuminanceAlpha:
+      return 2;
+    case TextureFormat::RGB:
+      return 3;
+    case TextureFormat::RGBA:
+      break;
+  }
+
+  return 4;
+}
+
+/// @brief Describes how the rows of a Python buffer are laid out in memory, in terms of GL unpack state.
+struct pixel_layout final
+{
+  const void* data{ nullptr };
+
+  GLint alignment{ 1 };
+
+  /// @brief The value for @c GL_UNPACK_ROW_LENGTH, or zero if the rows are packed according to the alignment alone.
+  GLint row_length{ 0 };
+};
+
+/// @brief Checks that a buffer holds an image with the given dimensions and format, without copying it.
+///
+/// @details The buffer can either be flat (in which case the rows are assumed to be tightly packed) or have the rows as
+///          its outermost dimension (such as a numpy array of shape (height, width, channels)). The pixels within a
+///          row must be contiguous, but the rows may be padded, for example when the array is a slice of a wider image.
+auto
+get_pixel_layout(const py::buffer_info& info, GLsizei width, GLsizei height, std::size_t pixel_bytes) -> pixel_layout
+{
+  if ((width < 0) || (height < 0)) {
+    throw py::value_error("Texture dimensions cannot be negative.");
+  }
+
+  const auto row_bytes = static_cast<std::size_t>(width) * pixel_bytes;
+
+  auto pitch = row_bytes;
+
+  if (info.ndim == 0) {
+    throw py::value_error("Pixel data must have at least one dimension.");
+  }
+
+  // The dimensions within a row must be C-contiguous and hold exactly one row of pixels.
+  auto expected_stride = static_cast<py::ssize_t>(info.itemsize);
+
+  const py::ssize_t first_row_dim = (info.ndim == 1) ? 0 : 1;
+
+  for (auto i = info.ndim - 1; i >= first_row_dim; i--) {
+    if ((info.shape[i] > 1) && (info.strides[i] != expected_stride)) {
+      throw py::value_error("The pixels within each row of the data must be contiguous.");
+    }
+    expected_stride *= info.shape[i];
+  }
+
+  const auto total_row_bytes = static_cast<std::size_t>(expected_stride);
+
+  if (info.ndim == 1) {
+    if (total_row_bytes != (row_bytes * static_cast<std::size_t>(height))) {
+      throw py::value_error("Expected " + std::to_string(row_bytes * static_cast<std::size_t>(height)) +
+                            " bytes of pixel data, but got " + std::to_string(total_row_bytes) + ".");
+    }
+  } else {
+    if (info.shape[0] != height) {
+      throw py::value_error("Expected " + std::to_string(height) + " rows of pixel data, but got " +
+                            std::to_string(info.shape[0]) + ".");
+    }
+    if (total_row_bytes != row_bytes) {
+      throw py::value_error("Expected " + std::to_string(row_bytes) + " bytes per row of pixel data, but got " +
+                            std::to_string(total_row_bytes) + ".");
+    }
+    if (info.strides[0] < 0) {
+      throw py::value_error("Pixel data with a negative row stride (such as a flipped view) is not supported.");
+    }
+    // Rows that overlap, such as those of a broadcast array with a row stride of zero, would make GL read past the end
+    // of the buffer.
+    if ((height > 1) && (static_cast<std::size_t>(info.strides[0]) < row_bytes)) {
+      throw py::value_error("The rows of the pixel data overlap (such as in a broadcast array). Pass a contiguous copy, "
+                            "for example with numpy.ascontiguousarray.");
+    }
+    if (height > 1) {
+      pitch = static_cast<std::size_t>(info.strides[0]);
+    }
+  }
+
+  pixel_layout layout;
+
+  layout.data = info.ptr;
+
+  const auto address = reinterpret_cast<std::uintptr_t>(info.ptr);
+
+  // Prefer describing the pitch with the alignment alone, since that works on every context version.
+  for (const GLint alignment : { 8, 4, 2, 1 }) {
+    const auto a = static_cast<std::size_t>(alignment);
+    if (((address % a) == 0) && ((pitch % a) == 0) && ((((row_bytes + a - 1) / a) * a) == pitch)) {
+      layout.alignment = alignment;
+      return layout;
+    }
+  }
+
+  if (((pitch % pixel_bytes) != 0) || !GLAD_GL_ES_VERSION_3_0) {
+    throw py::value_error("The row stride of the pixel data cannot be described to GL.");
+  }
+
+  for (const GLint alignment : { 8, 4, 2, 1 }) {
+    const auto a = static_cast<std::size_t>(alignment);
+    if (((address % a) == 0) && ((pitch % a) == 0)) {
+      layout.alignment = alignment;
+      break;
+    }
+  }
+
+  layout.row_length = static_cast<GLint>(pitch / pixel_bytes);
+
+  return layout;
+}
+
+/// @brief Sets the unpack state for a layout, calls the upload function, then restores the unpack state.
+template<typename Upload>
+void
+upload_pixels(const pixel_layout& layout, Upload upload)
+{
+  // The buffer stays locked by the caller's buffer_info, so the pixels can be copied without the GIL.
+  py::gil_scoped_release release;
+
+  GLint previous_alignment{ 4 };
+
+  glGetIntegerv(GL_UNPACK_ALIGNMENT, &previous_alignment);
+
+  glPixelStorei(GL_UNPACK_ALIGNMENT, layout.alignment);
+
+  if (layout.row_length != 0) {
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, layout.row_length);
+  }
+
+  upload(layout.data);
+
+  if (layout.row_length != 0) {
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+  }
+
+  glPixelStorei(GL_UNPACK_ALIGNMENT, previous_alignment);
+}
+
 void
 tex_image_2d(TextureTarget target,
              GLint level,
@@ -155,19 +329,29 @@ tex_image_2d(TextureTarget target,
              GLint border,
              TextureFormat format,
              TexelType type,
-             py::bytes& data)
+             const py::object& data)
 {
-  std::string_view data_view(data);
+  auto upload = [&](const void* pixels) {
+    glTexImage2D(static_cast<GLenum>(target),
+                 level,
+                 static_cast<GLint>(internal_format),
+                 width,
+                 height,
+                 border,
+                 static_cast<GLenum>(format),
+                 static_cast<GLenum>(type),
+                 pixels);
+  };
+
+  if (data.is_none()) {
+    // This only allocates the texture storage.
+    upload(nullptr);
+    return;
+  }
+
+  const auto info = py::reinterpret_borrow<py::buffer>(data).request();
 
-  glTexImage2D(static_cast<GLenum>(target),
-               level,
-               static_cast<GLint>(internal_format),
-               width,
-               height,
-               border,
-               static_cast<GLenum>(format),
-               static_cast<GLenum>(type),
-               data_view.data());
+  upload_pixels(get_pixel_layout(info, width, height, pixel_size(format, type)), upload);
 }
 
 void
@@ -179,17 +363,292 @@ tex_sub_image_2d(TextureTarget target,
                  GLsizei height,
                  TextureFormat format,
                  TexelType type,
-                 py::bytes& data)
+                 const py::buffer& data)
+{
+  const auto info = data.request();
+
+  upload_pixels(get_pixel_layout(info, width, height, pixel_size(format, type)), [&](const void* pixels) {
+    glTexSubImage2D(static_cast<GLenum>(target),
+                    level,
+                    xoffset,
+                    yoffset,
+                    width,
+                    height,
+                    static_cast<GLenum>(format),
+                    static_cast<GLenum>(type),
+                    pixels);
+  });
+}
+
+/// @brief Gets the size of a buffer that must be C-contiguous, such as vertex or index data.
+auto
+contiguous_size(const py::buffer_info& info) -> std::size_t
+{
+  auto expected_stride = static_cast<py::ssize_t>(info.itemsize);
+
+  for (auto i = info.ndim - 1; i >= 0; i--) {
+    if ((info.shape[i] > 1) && (info.strides[i] != expected_stride)) {
+      throw py::value_error("Buffer data must be C-contiguous (use numpy.ascontiguousarray to make a copy).");
+    }
+    expected_stride *= info.shape[i];
+  }
+
+  return static_cast<std::size_t>(expected_stride);
+}
+
+enum class BufferTarget : GLenum
+{
+  ArrayBuffer = GL_ARRAY_BUFFER,
+  ElementArrayBuffer = GL_ELEMENT_ARRAY_BUFFER,
+  UniformBuffer = GL_UNIFORM_BUFFER,
+  PixelUnpackBuffer = GL_PIXEL_UNPACK_BUFFER
+};
+
+void
+require_buffer_target(const BufferTarget target)
+{
+  if ((target == BufferTarget::UniformBuffer) || (target == BufferTarget::PixelUnpackBuffer)) {
+    require_es3("This buffer target");
+  }
+}
+
+enum class BufferUsage : GLenum
+{
+  StaticDraw = GL_STATIC_DRAW,
+  DynamicDraw = GL_DYNAMIC_DRAW,
+  StreamDraw = GL_STREAM_DRAW
+};
+
+auto
+gen_buffers(std::size_t n) -> std::vector<gl_buffer>
+{
+  std::vector<GLuint> ids(n);
+  glGenBuffers(static_cast<GLsizei>(n), ids.data());
+
+  std::vector<gl_buffer> buffers(n);
+  for (std::size_t i = 0; i < n; i++) {
+    buffers[i].id = ids[i];
+  }
+
+  return buffers;
+}
+
+void
+delete_buffers(const std::vector<gl_buffer>& buffers)
 {
-  glTexSubImage2D(static_cast<GLenum>(target),
-                  level,
-                  xoffset,
-                  yoffset,
-                  width,
-                  height,
-                  static_cast<GLenum>(format),
-                  static_cast<GLenum>(format),
-                  std::string_view(data).data());
+  auto& state = gl_state::current();
+
+  std::vector<GLuint> ids(buffers.size());
+  for (std::size_t i = 0; i < buffers.size(); i++) {
+    ids[i] = buffers[i].id;
+    state.forget_buffer(ids[i]);
+  }
+
+  glDeleteBuffers(static_cast<GLsizei>(ids.size()), ids.data());
+}
+
+void
+bind_buffer(BufferTarget target, const gl_buffer* buffer)
+{
+  require_buffer_target(target);
+
+  gl_state::current().bind_buffer(static_cast<GLenum>(target), buffer ? buffer->id : 0);
+}
+
+void
+buffer_data(BufferTarget target, const py::buffer& data, BufferUsage usage)
+{
+  require_buffer_target(target);
+
+  const auto info = data.request();
+
+  const auto size = static_cast<GLsizeiptr>(contiguous_size(info));
+
+  py::gil_scoped_release release;
+
+  glBufferData(static_cast<GLenum>(target), size, info.ptr, static_cast<GLenum>(usage));
+}
+
+void
+allocate_buffer_data(BufferTarget target, GLsizeiptr size, BufferUsage usage)
+{
+  require_buffer_target(target);
+
+  glBufferData(static_cast<GLenum>(target), size, nullptr, static_cast<GLenum>(usage));
+}
+
+void
+buffer_sub_data(BufferTarget target, GLintptr offset, const py::buffer& data)
+{
+  require_buffer_target(target);
+
+  const auto info = data.request();
+
+  const auto size = static_cast<GLsizeiptr>(contiguous_size(info));
+
+  py::gil_scoped_release release;
+
+  glBufferSubData(static_cast<GLenum>(target), offset, size, info.ptr);
+}
+
+auto
+gen_vertex_arrays(std::size_t n) -> std::vector<gl_vertex_array>
+{
+  require_es3("Vertex arrays");
+
+  std::vector<GLuint> ids(n);
+  glGenVertexArrays(static_cast<GLsizei>(n), ids.data());
+
+  std::vector<gl_vertex_array> vertex_arrays(n);
+  for (std::size_t i = 0; i < n; i++) {
+    vertex_arrays[i].id = ids[i];
+  }
+
+  return vertex_arrays;
+}
+
+void
+delete_vertex_arrays(const std::vector<gl_vertex_array>& vertex_arrays)
+{
+  require_es3("Vertex arrays");
+
+  auto& state = gl_state::current();
+
+  std::vector<GLuint> ids(vertex_arrays.size());
+  for (std::size_t i = 0; i < vertex_arrays.size(); i++) {
+    ids[i] = vertex_arrays[i].id;
+    state.forget_vertex_array(ids[i]);
+  }
+
+  glDeleteVertexArrays(static_cast<GLsizei>(ids.size()), ids.data());
+}
+
+void
+bind_vertex_array(const gl_vertex_array* vertex_array)
+{
+  require_es3("Vertex arrays");
+
+  gl_state::current().bind_vertex_array(vertex_array ? vertex_array->id : 0);
+}
+
+enum class DataType : GLenum
+{
+  Byte = GL_BYTE,
+  UnsignedByte = GL_UNSIGNED_BYTE,
+  Short = GL_SHORT,
+  UnsignedShort = GL_UNSIGNED_SHORT,
+  Int = GL_INT,
+  UnsignedInt = GL_UNSIGNED_INT,
+  HalfFloat = GL_HALF_FLOAT,
+  Float = GL_FLOAT
+};
+
+void
+vertex_attrib_pointer(GLuint index, GLint size, DataType type, bool normalized, GLsizei stride, std::size_t offset)
+{
+  glVertexAttribPointer(index,
+                        size,
+                        static_cast<GLenum>(type),
+                        normalized ? GL_TRUE : GL_FALSE,
+                        stride,
+                        reinterpret_cast<const void*>(offset));
+}
+
+enum class PrimitiveMode : GLenum
+{
+  Points = GL_POINTS,
+  Lines = GL_LINES,
+  LineStrip = GL_LINE_STRIP,
+  LineLoop = GL_LINE_LOOP,
+  Triangles = GL_TRIANGLES,
+  TriangleStrip = GL_TRIANGLE_STRIP,
+  TriangleFan = GL_TRIANGLE_FAN
+};
+
+enum class IndexType : GLenum
+{
+  UnsignedByte = GL_UNSIGNED_BYTE,
+  UnsignedShort = GL_UNSIGNED_SHORT,
+  UnsignedInt = GL_UNSIGNED_INT
+};
+
+void
+draw_arrays(PrimitiveMode mode, GLint first, GLsizei count)
+{
+  glDrawArrays(static_cast<GLenum>(mode), first, count);
+}
+
+void
+draw_arrays_instanced(PrimitiveMode mode, GLint first, GLsizei count, GLsizei instance_count)
+{
+  require_es3("Instanced drawing");
+
+  glDrawArraysInstanced(static_cast<GLenum>(mode), first, count, instance_count);
+}
+
+void
+draw_elements(PrimitiveMode mode, GLsizei count, IndexType type, std::size_t offset)
+{
+  glDrawElements(static_cast<GLenum>(mode), count, static_cast<GLenum>(type), reinterpret_cast<const void*>(offset));
+}
+
+void
+draw_elements_instanced(PrimitiveMode mode, GLsizei count, IndexType type, std::size_t offset, GLsizei instance_count)
+{
+  require_es3("Instanced drawing");
+
+  glDrawElementsInstanced(
+    static_cast<GLenum>(mode), count, static_cast<GLenum>(type), reinterpret_cast<const void*>(offset), instance_count);
+}
+
+auto
+compile_program(const std::string& vertex_source,
+                const std::string& fragment_source,
+                const std::vector<std::pair<std::string, std::string>>& defines,
+                shader_version version) -> gl_program
+{
+  if (version == shader_version::es_300) {
+    require_es3("ShaderVersion.ES_300");
+  }
+
+  gl_program p;
+
+  p.id = compile_shader(vertex_source.c_str(), fragment_source.c_str(), defines, version);
+
+  return p;
+}
+
+void
+delete_program(const gl_program& p)
+{
+  gl_state::current().forget_program(p.id);
+
+  glDeleteProgram(p.id);
+}
+
+void
+use_program(const gl_program* p)
+{
+  gl_state::current().use_program(p ? p->id : 0);
+}
+
+/// @brief Reads a uniform array argument, which must hold a multiple of @p count 32-bit floats.
+auto
+float_array(const py::buffer& data, std::size_t count) -> std::pair<py::buffer_info, GLsizei>
+{
+  auto info = data.request();
+
+  if (info.format != py::format_descriptor<float>::format()) {
+    throw py::value_error("Expected float32 data.");
+  }
+
+  const auto size = contiguous_size(info) / sizeof(float);
+
+  if ((size == 0) || ((size % count) != 0)) {
+    throw py::value_error("Expected a multiple of " + std::to_string(count) + " floats.");
+  }
+
+  return { std::move(info), static_cast<GLsizei>(size / count) };
 }
 
 } // namespace
@@ -246,10 +705,65 @@ def_gl_module(pybind11::module_&& mod)
 
   py::class_<gl_texture>(mod, "Texture");
 
+  py::enum_<BufferTarget>(mod, "BufferTarget")
+    .value("ARRAY_BUFFER", BufferTarget::ArrayBuffer)
+    .value("ELEMENT_ARRAY_BUFFER", BufferTarget::ElementArrayBuffer)
+    .value("UNIFORM_BUFFER", BufferTarget::UniformBuffer)
+    .value("PIXEL_UNPACK_BUFFER", BufferTarget::PixelUnpackBuffer);
+
+  py::enum_<BufferUsage>(mod, "BufferUsage")
+    .value("STATIC_DRAW", BufferUsage::StaticDraw)
+    .value("DYNAMIC_DRAW", BufferUsage::DynamicDraw)
+    .value("STREAM_DRAW", BufferUsage::StreamDraw);
+
+  py::enum_<DataType>(mod, "DataType")
+    .value("BYTE", DataType::Byte)
+    .value("UNSIGNED_BYTE", DataType::UnsignedByte)
+    .value("SHORT", DataType::Short)
+    .value("UNSIGNED_SHORT", DataType::UnsignedShort)
+    .value("INT", DataType::Int)
+    .value("UNSIGNED_INT", DataType::UnsignedInt)
+    .value("HALF_FLOAT", DataType::HalfFloat)
+    .value("FLOAT", DataType::Float);
+
+  py::enum_<PrimitiveMode>(mod, "PrimitiveMode")
+    .value("POINTS", PrimitiveMode::Points)
+    .value("LINES", PrimitiveMode::Lines)
+    .value("LINE_STRIP", PrimitiveMode::LineStrip)
+    .value("LINE_LOOP", PrimitiveMode::LineLoop)
+    .value("TRIANGLES", PrimitiveMode::Triangles)
+    .value("TRIANGLE_STRIP", PrimitiveMode::TriangleStrip)
+    .value("TRIANGLE_FAN", PrimitiveMode::TriangleFan);
+
+  py::enum_<IndexType>(mod, "IndexType")
+    .value("UNSIGNED_BYTE", IndexType::UnsignedByte)
+    .value("UNSIGNED_SHORT", IndexType::UnsignedShort)
+    .value("UNSIGNED_INT", IndexType::UnsignedInt);
+
+  py::enum_<shader_version>(mod, "ShaderVersion")
+    .value("ES_100", shader_version::es_100)
+    .value("ES_300", shader_version::es_300);
+
+  py::class_<gl_buffer>(mod, "Buffer");
+
+  py::class_<gl_vertex_array>(mod, "VertexArray");
+
+  py::class_<gl_program>(mod, "Program");
+
+  py::class_<gl_call_stats>(mod, "CallStats")
+    .def_readonly("calls", &gl_call_stats::calls)
+    .def_readonly("draw_calls", &gl_call_stats::draw_calls)
+    .def_readonly("state_changes", &gl_call_stats::state_changes)
+    .def_readonly("texture_upload_bytes", &gl_call_stats::texture_upload_bytes)
+    .def_readonly("buffer_upload_bytes", &gl_call_stats::buffer_upload_bytes)
+    .def_readonly("error_checks", &gl_call_stats::error_checks);
+
   mod.attr("COLOR_BUFFER_BIT") = GL_COLOR_BUFFER_BIT;
   mod.attr("DEPTH_BUFFER_BIT") = GL_DEPTH_BUFFER_BIT;
 
   mod.def("get_error", &get_error);
+  mod.def("call_stats_available", &gl_call_stats_available);
+  mod.def("get_call_stats", &get_gl_call_stats);
   mod.def("viewport", &viewport, py::arg("x"), py::arg("y"), py::arg("width"), py::arg("height"));
   mod.def("clear", &clear, py::arg("flags"));
   mod.def("clear_color", &clear_color, py::arg("r"), py::arg("g"), py::arg("b"), py::arg("a"));
@@ -258,7 +772,7 @@ def_gl_module(pybind11::module_&& mod)
   mod.def("bind_texture", &bind_texture, py::arg("target"), py::arg("texture"));
   mod.def(
     "set_texture_int_parameter", &set_texture_int_parameter, py::arg("target"), py::arg("param"), py::arg("value"));
-  mod.def("set_active_texture", [](GLint index) { glActiveTexture(GL_TEXTURE0 + index); }, py::arg("index"));
+  mod.def("set_active_texture", [](GLuint index) { gl_state::current().active_texture(index); }, py::arg("index"));
   mod.def("tex_image_2d",
           &tex_image_2d,
           py::arg("target"),
@@ -281,6 +795,105 @@ def_gl_module(pybind11::module_&& mod)
           py::arg("format"),
           py::arg("type"),
           py::arg("data"));
+  mod.def("gen_buffers", &gen_buffers, py::arg("num_buffers"));
+  mod.def("delete_buffers", &delete_buffers, py::arg("buffers"));
+  mod.def("bind_buffer", &bind_buffer, py::arg("target"), py::arg("buffer").none(true));
+  mod.def("buffer_data", &buffer_data, py::arg("target"), py::arg("data"), py::arg("usage"));
+  mod.def("buffer_data", &allocate_buffer_data, py::arg("target"), py::arg("size"), py::arg("usage"));
+  mod.def("buffer_sub_data", &buffer_sub_data, py::arg("target"), py::arg("offset"), py::arg("data"));
+  mod.def("gen_vertex_arrays", &gen_vertex_arrays, py::arg("num_vertex_arrays"));
+  mod.def("delete_vertex_arrays", &delete_vertex_arrays, py::arg("vertex_arrays"));
+  mod.def("bind_vertex_array", &bind_vertex_array, py::arg("vertex_array").none(true));
+  mod.def("enable_vertex_attrib_array", [](GLuint index) { glEnableVertexAttribArray(index); }, py::arg("index"));
+  mod.def("disable_vertex_attrib_array", [](GLuint index) { glDisableVertexAttribArray(index); }, py::arg("index"));
+  mod.def("vertex_attrib_pointer",
+          &vertex_attrib_pointer,
+          py::arg("index"),
+          py::arg("size"),
+          py::arg("type"),
+          py::arg("normalized"),
+          py::arg("stride"),
+          py::arg("offset") = 0);
+  mod.def(
+    "vertex_attrib_divisor",
+    [](GLuint index, GLuint divisor) {
+      require_es3("Vertex attribute divisors");
+      glVertexAttribDivisor(index, divisor);
+    },
+    py::arg("index"),
+    py::arg("divisor"));
+  mod.def("draw_arrays", &draw_arrays, py::arg("mode"), py::arg("first"), py::arg("count"));
+  mod.def("draw_arrays_instanced",
+          &draw_arrays_instanced,
+          py::arg("mode"),
+          py::arg("first"),
+          py::arg("count"),
+          py::arg("instance_count"));
+  mod.def("draw_elements", &draw_elements, py::arg("mode"), py::arg("count"), py::arg("type"), py::arg("offset") = 0);
+  mod.def("draw_elements_instanced",
+          &draw_elements_instanced,
+          py::arg("mode"),
+          py::arg("count"),
+          py::arg("type"),
+          py::arg("offset"),
+          py::arg("instance_count"));
+  mod.def("compile_program",
+          &compile_program,
+          py::arg("vertex_source"),
+          py::arg("fragment_source"),
+          py::arg("defines") = std::vector<std::pair<std::string, std::string>>{},
+          py::arg("version") = shader_version::es_100);
+  mod.def("delete_program", &delete_program, py::arg("program"));
+  mod.def("use_program", &use_program, py::arg("program").none(true));
+  mod.def(
+    "get_uniform_location",
+    [](const gl_program& p, const std::string& name) { return glGetUniformLocation(p.id, name.c_str()); },
+    py::arg("program"),
+    py::arg("name"));
+  mod.def(
+    "get_attrib_location",
+    [](const gl_program& p, const std::string& name) { return glGetAttribLocation(p.id, name.c_str()); },
+    py::arg("program"),
+    py::arg("name"));
+  mod.def("uniform_1i", [](GLint loc, GLint x) { glUniform1i(loc, x); }, py::arg("location"), py::arg("x"));
+  mod.def("uniform_1f", [](GLint loc, GLfloat x) { glUniform1f(loc, x); }, py::arg("location"), py::arg("x"));
+  mod.def(
+    "uniform_2f",
+    [](GLint loc, GLfloat x, GLfloat y) { glUniform2f(loc, x, y); },
+    py::arg("location"),
+    py::arg("x"),
+    py::arg("y"));
+  mod.def(
+    "uniform_3f",
+    [](GLint loc, GLfloat x, GLfloat y, GLfloat z) { glUniform3f(loc, x, y, z); },
+    py::arg("location"),
+    py::arg("x"),
+    py::arg("y"),
+    py::arg("z"));
+  mod.def(
+    "uniform_4f",
+    [](GLint loc, GLfloat x, GLfloat y, GLfloat z, GLfloat w) { glUniform4f(loc, x, y, z, w); },
+    py::arg("location"),
+    py::arg("x"),
+    py::arg("y"),
+    py::arg("z"),
+    py::arg("w"));
+  mod.def(
+    "uniform_matrix_3",
+    [](GLint loc, const py::buffer& data) {
+      const auto arr = float_array(data, 9);
+      glUniformMatrix3fv(loc, arr.second, GL_FALSE, static_cast<const GLfloat*>(arr.first.ptr));
+    },
+    py::arg("location"),
+    py::arg("data"));
+  mod.def(
+    "uniform_matrix_4",
+    [](GLint loc, const py::buffer& data) {
+      const auto arr = float_array(data, 16);
+      glUniformMatrix4fv(loc, arr.second, GL_FALSE, static_cast<const GLfloat*>(arr.first.ptr));
+    },
+    py::arg("location"),
+    py::arg("data"));
 }
 
 } // namespace glow::python
@@ -26,6 +26,9 @@ struct gl_program final : public gl_object<gl_program>
 struct gl_texture final : public gl_object<gl_texture>
 {};
 
+struct gl_vertex_array final : public gl_object<gl_vertex_array>
+{};
+
 void
 def_gl_module(pybind11::module_&& m);
 
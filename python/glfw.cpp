@@ -1,6 +1,8 @@
 #include "glfw.hpp"
 
 #include <glow/fonts.hpp>
+#include <glow/gl_state.hpp>
+#include <glow/gl_stats.hpp>
 
 #include <pybind11/stl.h>
 
@@ -30,11 +32,22 @@ init() -> void
     throw std::runtime_error("Failed to initialize GLFW.");
   }
 
-  glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 2);
-  glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
   glfwWindowHint(GLFW_CLIENT_API, GLFW_OPENGL_ES_API);
 }
 
+/// @brief Creates a window, with an OpenGL ES context of the given version.
+///
+/// @return The window, or null if the context version is not available.
+auto
+create_window(const int w, const int h, const std::string& title, GLFWmonitor* mon, const int major_version)
+  -> GLFWwindow*
+{
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, major_version);
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
+
+  return glfwCreateWindow(w, h, title.c_str(), mon, nullptr);
+}
+
 class monitor final
 {
 public:
@@ -60,7 +73,13 @@ public:
   {
     GLFWmonitor* mon_ptr = mon.has_value() ? mon->ptr() : nullptr;
 
-    m_window = glfwCreateWindow(w, h, title.c_str(), mon_ptr, nullptr);
+    // ES 3.0 is preferred, so that the ES 3.0 parts of the gl module work, but ES 2.0 is accepted in its place.
+
+    m_window = create_window(w, h, title, mon_ptr, 3);
+
+    if (!m_window) {
+      m_window = create_window(w, h, title, mon_ptr, 2);
+    }
 
     if (!m_window) {
       return;
@@ -70,11 +89,13 @@ public:
 
     gladLoadGLES2Loader(reinterpret_cast<GLADloadproc>(glfwGetProcAddress));
 
+    glow::install_gl_call_hooks();
+
     IMGUI_CHECKVERSION();
 
     m_imgui_context = ImGui::CreateContext();
 
-    ImGui_ImplOpenGL3_Init("#version 100");
+    ImGui_ImplOpenGL3_Init(GLAD_GL_ES_VERSION_3_0 ? "#version 300 es" : "#version 100");
 
     ImGui_ImplGlfw_InitForOpenGL(m_window, true);
 
@@ -154,6 +175,9 @@ public:
   {
     glfwMakeContextCurrent(m_window);
 
+    // The state cache is per thread, so it may describe another window's context.
+    glow::gl_state::current().invalidate();
+
     ImGui::SetCurrentContext(m_imgui_context);
 
     ImPlot::SetCurrentContext(m_implot_context);
@@ -177,7 +201,11 @@ public:
 
     ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
 
+    glow::gl_state::current().invalidate();
+
     glfwSwapBuffers(m_window);
+
+    glow::end_gl_call_stats_frame();
   }
 
   auto get_framebuffer_size() const -> py::tuple
@@ -215,10 +243,13 @@ def_glfw_module(py::module_&& m)
   m.def("get_primary_monitor", monitor::primary);
   py::class_<monitor>(m, "Monitor").def("name", &monitor::name);
 
-  m.def("poll_events", glfwPollEvents);
+  // None of the callbacks installed by glow call back into Python, so the GIL can be released while events are
+  // dispatched.
+  m.def("poll_events", glfwPollEvents, py::call_guard<py::gil_scoped_release>());
 
   py::class_<window>(m, "Window")
     .def(py::init<int, int, std::string, std::optional<monitor>, float>(),
+         py::call_guard<py::gil_scoped_release>(),
          py::arg("window_width"),
          py::arg("window_height"),
          py::arg("title"),
@@ -227,7 +258,7 @@ def_glfw_module(py::module_&& m)
     .def("close", &window::close)
     .def("set_imgui_config_path", &window::set_imgui_config_path, py::arg("config_path"))
     .def("begin_frame", &window::begin_frame)
-    .def("end_frame", &window::end_frame)
+    .def("end_frame", &window::end_frame, py::call_guard<py::gil_scoped_release>())
     .def("is_open", &window::is_open)
     .def("should_close", &window::should_close)
     .def("set_should_close", &window::set_should_close, py::arg("should_close_flag"))
@@ -2,12 +2,25 @@
 
 #include "gl.hpp"
 
+#include <glow/line_decimator.hpp>
+#include <glow/plot_ring.hpp>
+#include <glow/sample_file.hpp>
+#include <glow/time_series.hpp>
+
 #include <pybind11/numpy.h>
+#include <pybind11/stl.h>
 
+#include <imgui.h>
 #include <implot.h>
 
+#include <limits>
+#include <map>
+#include <memory>
+#include <optional>
 #include <sstream>
 #include <stdexcept>
+#include <string>
+#include <type_traits>
 
 #include <cstddef>
 #include <cstdint>
@@ -49,20 +62,230 @@ enum class LineFlags : std::uint32_t
   Shaded = ImPlotLineFlags_Shaded
 };
 
-void
-plot_line(const char* label, py::array_t<float, py::array::f_style | py::array::forcecast> data, const LineFlags flags)
+/// @brief Describes a 1D array of values, or an (N, 2) array of points, as ImPlot pointer, count and stride arguments.
+struct series final
 {
-  const auto* shape = data.shape();
+  /// @brief The first x value, or null if the x values are implied by the index.
+  const void* xs{ nullptr };
 
-  if (data.ndim() == 2) {
-    ImPlot::PlotLine(label, data.data(), data.data() + shape[0], shape[0], static_cast<ImPlotLineFlags>(flags));
-  } else if (data.ndim() == 1) {
-    ImPlot::PlotLine(label, data.data(), static_cast<int>(shape[0]), 1.0, 0.0, static_cast<ImPlotLineFlags>(flags));
-  } else {
+  const void* ys{ nullptr };
+
+  int count{ 0 };
+
+  /// @brief The distance between consecutive values, in bytes.
+  int stride{ 0 };
+};
+
+/// @brief Gets the layout of a series from an array's shape and strides.
+///
+/// @return The layout, or nothing if the strides cannot be passed to ImPlot (for example, if they are negative).
+auto
+get_series(const py::array& data, const char* plot_kind) -> std::optional<series>
+{
+  if ((data.ndim() != 1) && (data.ndim() != 2)) {
     std::ostringstream stream;
-    stream << "Line plots accept 1 or 2 dimensions, not " << data.ndim();
+    stream << plot_kind << " plots accept 1 or 2 dimensions, not " << data.ndim();
     throw std::runtime_error(stream.str());
   }
+
+  if ((data.ndim() == 2) && (data.shape(1) < 2)) {
+    std::ostringstream stream;
+    stream << plot_kind << " plots of 2 dimensional data expect x and y columns, but got " << data.shape(1);
+    throw std::runtime_error(stream.str());
+  }
+
+  const auto stride = data.strides(0);
+
+  const auto column_stride = (data.ndim() == 2) ? data.strides(1) : 0;
+
+  constexpr auto int_max = static_cast<py::ssize_t>(std::numeric_limits<int>::max());
+
+  if ((data.shape(0) > int_max) || (stride < 0) || (stride > int_max) || (column_stride < 0)) {
+    return std::nullopt;
+  }
+
+  const auto* bytes = static_cast<const unsigned char*>(data.data());
+
+  series s;
+  s.count = static_cast<int>(data.shape(0));
+  s.stride = static_cast<int>(stride);
+
+  if (data.ndim() == 2) {
+    s.xs = bytes;
+    s.ys = bytes + column_stride;
+  } else {
+    s.ys = bytes;
+  }
+
+  return s;
+}
+
+/// @brief Calls a function with a null pointer of the element type of an array, if ImPlot has an overload for it.
+///
+/// @return False if the element type is not supported (such as bool, float16 or non-native byte order).
+template<typename Func>
+auto
+visit_dtype(const py::dtype& dtype, Func&& func) -> bool
+{
+  if (!dtype.attr("isnative").cast<bool>()) {
+    return false;
+  }
+
+  const auto size = dtype.itemsize();
+
+  switch (dtype.kind()) {
+    case 'f':
+      switch (size) {
+        case 4:
+          func(static_cast<const float*>(nullptr));
+          return true;
+        case 8:
+          func(static_cast<const double*>(nullptr));
+          return true;
+      }
+      break;
+    case 'i':
+      switch (size) {
+        case 1:
+          func(static_cast<const ImS8*>(nullptr));
+          return true;
+        case 2:
+          func(static_cast<const ImS16*>(nullptr));
+          return true;
+        case 4:
+          func(static_cast<const ImS32*>(nullptr));
+          return true;
+        case 8:
+          func(static_cast<const ImS64*>(nullptr));
+          return true;
+      }
+      break;
+    case 'u':
+      switch (size) {
+        case 1:
+          func(static_cast<const ImU8*>(nullptr));
+          return true;
+        case 2:
+          func(static_cast<const ImU16*>(nullptr));
+          return true;
+        case 4:
+          func(static_cast<const ImU32*>(nullptr));
+          return true;
+        case 8:
+          func(static_cast<const ImU64*>(nullptr));
+          return true;
+      }
+      break;
+  }
+
+  return false;
+}
+
+/// @brief Plots an array in place if its element type and strides allow it, and plots a float64 copy otherwise.
+template<typename Plot>
+void
+plot_series(const py::array& data, const char* plot_kind, Plot plot)
+{
+  const auto s = get_series(data, plot_kind);
+
+  if (s && visit_dtype(data.dtype(), [&](auto type) { plot(type, *s); })) {
+    return;
+  }
+
+  const auto converted = py::array_t<double, py::array::c_style | py::array::forcecast>::ensure(data);
+  if (!converted) {
+    throw std::runtime_error(std::string(plot_kind) + " plots require numeric data.");
+  }
+
+  const auto converted_series = get_series(converted, plot_kind);
+
+  plot(static_cast<const double*>(nullptr), converted_series.value());
+}
+
+/// @brief The number of frames a decimated line can go unplotted before its cache is released.
+constexpr int decimator_lifetime{ 120 };
+
+struct decimator_entry final
+{
+  std::unique_ptr<line_decimator> decimator{ new line_decimator() };
+
+  /// @brief The array that was last plotted with the decimator.
+  ///
+  /// @details The decimator recognizes its data by address, so the array is kept alive while its reduction is cached.
+  ///          Otherwise a new array that happens to be allocated at the same address would be drawn with the stale
+  ///          reduction.
+  py::object source;
+
+  int last_frame{};
+};
+
+/// @brief Gets the decimator for a line in the current plot, creating it if this is the first time it is plotted.
+///
+/// @details Lines are identified by their label, which ImPlot scopes to the current plot, since Python code has
+///          nowhere obvious to keep a decimator of its own. The decimator itself notices when the contents of the
+///          same array change (through the version), and is invalidated here when a different array is passed.
+auto
+get_decimator(const char* label, const py::object& source) -> line_decimator&
+{
+  // The map is never destroyed, since the arrays it refers to cannot be released after the interpreter shuts down.
+  static auto* decimators = new std::map<ImGuiID, decimator_entry>();
+
+  static int last_sweep{};
+
+  const auto frame = ImGui::GetFrameCount();
+
+  if (frame != last_sweep) {
+    last_sweep = frame;
+    for (auto it = decimators->begin(); it != decimators->end();) {
+      it = ((frame - it->second.last_frame) > decimator_lifetime) ? decimators->erase(it) : std::next(it);
+    }
+  }
+
+  auto& entry = (*decimators)[ImGui::GetID(label)];
+
+  entry.last_frame = frame;
+
+  if (!entry.source.is(source)) {
+    entry.decimator->invalidate();
+    entry.source = source;
+  }
+
+  return *entry.decimator;
+}
+
+void
+plot_line(const char* label,
+          const py::array& data,
+          const LineFlags flags,
+          const bool decimate,
+          const std::uint64_t version)
+{
+  if (decimate) {
+    plot_series(data, "Line", [&](auto type, const series& s) {
+      using T = std::remove_const_t<std::remove_pointer_t<decltype(type)>>;
+      const auto* xs = static_cast<const T*>(s.xs);
+      const auto* ys = static_cast<const T*>(s.ys);
+      auto& decimator = get_decimator(label, data);
+      const auto count = static_cast<std::size_t>(s.count);
+      if (xs) {
+        decimator.plot(label, xs, ys, count, static_cast<ImPlotLineFlags>(flags), version, s.stride);
+      } else {
+        decimator.plot(label, ys, count, 1.0, 0.0, static_cast<ImPlotLineFlags>(flags), version, s.stride);
+      }
+    });
+    return;
+  }
+
+  plot_series(data, "Line", [&](auto type, const series& s) {
+    using T = std::remove_const_t<std::remove_pointer_t<decltype(type)>>;
+    const auto* xs = static_cast<const T*>(s.xs);
+    const auto* ys = static_cast<const T*>(s.ys);
+    if (xs) {
+      ImPlot::PlotLine(label, xs, ys, s.count, static_cast<ImPlotLineFlags>(flags), 0, s.stride);
+    } else {
+      ImPlot::PlotLine(label, ys, s.count, 1.0, 0.0, static_cast<ImPlotLineFlags>(flags), 0, s.stride);
+    }
+  });
 }
 
 enum class ScatterFlags : std::uint32_t
@@ -72,20 +295,60 @@ enum class ScatterFlags : std::uint32_t
 };
 
 void
-plot_scatter(const char* label,
-             py::array_t<float, py::array::f_style | py::array::forcecast> data,
-             const ScatterFlags flags)
+plot_scatter(const char* label, const py::array& data, const ScatterFlags flags)
 {
-  const auto* shape = data.shape();
-  if (data.ndim() == 2) {
-    ImPlot::PlotScatter(label, data.data(), data.data() + shape[1], shape[1], static_cast<ImPlotScatterFlags>(flags));
-  } else if (data.ndim() == 1) {
-    ImPlot::PlotScatter(label, data.data(), shape[0], 1.0, 0.0, static_cast<ImPlotScatterFlags>(flags));
-  } else {
+  plot_series(data, "Scatter", [&](auto type, const series& s) {
+    using T = std::remove_const_t<std::remove_pointer_t<decltype(type)>>;
+    const auto* xs = static_cast<const T*>(s.xs);
+    const auto* ys = static_cast<const T*>(s.ys);
+    if (xs) {
+      ImPlot::PlotScatter(label, xs, ys, s.count, static_cast<ImPlotScatterFlags>(flags), 0, s.stride);
+    } else {
+      ImPlot::PlotScatter(label, ys, s.count, 1.0, 0.0, static_cast<ImPlotScatterFlags>(flags), 0, s.stride);
+    }
+  });
+}
+
+/// @brief Appends rows to a ring buffer, from either a 1D array of whole rows or an (N, columns) array.
+void
+append_rows(plot_ring& ring, const py::array_t<double, py::array::c_style | py::array::forcecast>& data)
+{
+  const auto columns = static_cast<py::ssize_t>(ring.columns());
+
+  if ((data.ndim() == 2) && (data.shape(1) != columns)) {
+    std::ostringstream stream;
+    stream << "Expected " << columns << " columns per row, but got " << data.shape(1);
+    throw std::runtime_error(stream.str());
+  }
+
+  if ((data.ndim() > 2) || ((data.size() % columns) != 0)) {
+    std::ostringstream stream;
+    stream << "Expected a 1 or 2 dimensional array of rows with " << columns << " values each.";
+    throw std::runtime_error(stream.str());
+  }
+
+  ring.append(data.data(), static_cast<std::size_t>(data.size() / columns));
+}
+
+/// @brief Appends samples to a time series, from a 1D array of times and an array with one row of values per time.
+void
+append_samples(time_series& series,
+               const py::array_t<double, py::array::c_style | py::array::forcecast>& times,
+               const py::array_t<double, py::array::c_style | py::array::forcecast>& values)
+{
+  if (times.ndim() != 1) {
+    throw std::runtime_error("Expected a 1 dimensional array of times.");
+  }
+
+  const auto expected = times.shape(0) * static_cast<py::ssize_t>(series.channels());
+
+  if ((values.ndim() > 2) || (values.size() != expected) || (values.shape(0) != times.shape(0))) {
     std::ostringstream stream;
-    stream << "Scatter plots accept 1 or 2 dimensions, not " << data.ndim();
+    stream << "Expected " << times.shape(0) << " rows of " << series.channels() << " values.";
     throw std::runtime_error(stream.str());
   }
+
+  series.append(times.data(), values.data(), static_cast<std::size_t>(times.shape(0)));
 }
 
 enum class ImageFlags : ImPlotImageFlags
@@ -149,11 +412,103 @@ def_implot_module(pybind11::module_&& m)
     .value("SKIP_NAN", LineFlags::SkipNaN)
     .value("NO_CLIP", LineFlags::NoClip)
     .value("SHADED", LineFlags::Shaded);
-  m.def("plot_line", &plot_line, py::arg("label"), py::arg("data"), py::arg("flags") = LineFlags::None);
+  m.def("plot_line",
+        &plot_line,
+        py::arg("label"),
+        py::arg("data"),
+        py::arg("flags") = LineFlags::None,
+        py::arg("decimate") = false,
+        py::arg("version") = 0);
 
   py::enum_<ScatterFlags>(m, "ScatterFlags").value("NONE", ScatterFlags::None).value("NO_CLIP", ScatterFlags::NoClip);
   m.def("plot_scatter", &plot_scatter, py::arg("label"), py::arg("data"), py::arg("flags") = ScatterFlags::None);
 
+  py::class_<plot_ring>(m, "RingBuffer")
+    .def(py::init<std::size_t, std::size_t, bool>(),
+         py::arg("capacity"),
+         py::arg("channels") = 1,
+         py::arg("time") = false)
+    .def("append", &append_rows, py::arg("data"))
+    .def("clear", &plot_ring::clear)
+    .def(
+      "plot_line",
+      [](const plot_ring& self,
+         const char* label,
+         const std::size_t channel,
+         const LineFlags flags,
+         const double x_scale) {
+        self.plot_line(label, channel, static_cast<ImPlotLineFlags>(flags), x_scale);
+      },
+      py::arg("label"),
+      py::arg("channel") = 0,
+      py::arg("flags") = LineFlags::None,
+      py::arg("x_scale") = 1.0)
+    .def(
+      "plot_scatter",
+      [](const plot_ring& self,
+         const char* label,
+         const std::size_t channel,
+         const ScatterFlags flags,
+         const double x_scale) {
+        self.plot_scatter(label, channel, static_cast<ImPlotScatterFlags>(flags), x_scale);
+      },
+      py::arg("label"),
+      py::arg("channel") = 0,
+      py::arg("flags") = ScatterFlags::None,
+      py::arg("x_scale") = 1.0)
+    .def("x_range", &plot_ring::x_range, py::arg("x_scale") = 1.0)
+    .def("__len__", &plot_ring::size)
+    .def_property_readonly("capacity", &plot_ring::capacity)
+    .def_property_readonly("channels", &plot_ring::channels)
+    .def_property_readonly("has_time", &plot_ring::has_time)
+    .def_property_readonly("total_count", &plot_ring::total_count);
+
+  py::class_<time_series>(m, "TimeSeries")
+    .def(py::init<std::size_t, std::size_t>(), py::arg("channels") = 1, py::arg("chunk_size") = 4096)
+    .def("append", &append_samples, py::arg("times"), py::arg("values"))
+    .def("discard_before", &time_series::discard_before, py::arg("time"))
+    .def("clear", &time_series::clear)
+    .def(
+      "plot_line",
+      [](time_series& self, const char* label, const std::size_t channel, const LineFlags flags) {
+        self.plot_line(label, channel, static_cast<ImPlotLineFlags>(flags));
+      },
+      py::arg("label"),
+      py::arg("channel") = 0,
+      py::arg("flags") = LineFlags::None)
+    .def(
+      "plot_envelope",
+      [](time_series& self, const char* label, const std::size_t channel) { self.plot_envelope(label, channel); },
+      py::arg("label"),
+      py::arg("channel") = 0)
+    .def("time_range", &time_series::time_range)
+    .def("__len__", &time_series::size)
+    .def_property_readonly("channels", &time_series::channels)
+    .def_property_readonly("chunk_size", &time_series::chunk_size);
+
+  // Opening a file may build its overview index, which reads the whole file.
+  py::class_<sample_file>(m, "SampleFile")
+    .def(py::init<const std::string&>(), py::arg("path"), py::call_guard<py::gil_scoped_release>())
+    .def(
+      "plot_line",
+      [](sample_file& self, const char* label, const std::size_t channel, const LineFlags flags) {
+        self.plot_line(label, channel, static_cast<ImPlotLineFlags>(flags));
+      },
+      py::arg("label"),
+      py::arg("channel") = 0,
+      py::arg("flags") = LineFlags::None)
+    .def(
+      "plot_envelope",
+      [](sample_file& self, const char* label, const std::size_t channel) { self.plot_envelope(label, channel); },
+      py::arg("label"),
+      py::arg("channel") = 0)
+    .def("value", &sample_file::value, py::arg("channel"), py::arg("index"))
+    .def("time_range", &sample_file::time_range)
+    .def("__len__", &sample_file::size)
+    .def_property_readonly("channels", &sample_file::channels)
+    .def_property_readonly("sample_rate", &sample_file::sample_rate)
+    .def_property_readonly("start_time", &sample_file::start_time);
+
   py::enum_<ImageFlags>(m, "ImageFlags").value("NONE", ImageFlags::None);
   m.def("plot_image",
         &plot_image,
@@ -10,6 +10,9 @@ namespace {
 
 namespace py = pybind11;
 
+/// @brief The dialogs spawn a process and wait on it, so none of these calls should hold the GIL.
+using release_gil = py::call_guard<py::gil_scoped_release>;
+
 } // namespace
 
 void
@@ -17,26 +20,28 @@ def_pfd_module(pybind11::module_&& m)
 {
   py::class_<pfd::open_file>(m, "OpenFileDialog")
     .def(py::init<std::string, std::string, std::vector<std::string>>(),
+         release_gil(),
          py::arg("title"),
          py::arg("default_path") = "",
          py::arg("filters") = std::vector<std::string>{ "All Files", "*" })
-    .def("result", &pfd::open_file::result)
-    .def("ready", &pfd::open_file::ready, py::arg("timeout") = pfd::internal::default_wait_timeout)
+    .def("result", &pfd::open_file::result, release_gil())
+    .def("ready", &pfd::open_file::ready, release_gil(), py::arg("timeout") = pfd::internal::default_wait_timeout)
     .def("kill", &pfd::open_file::kill);
 
   py::class_<pfd::save_file>(m, "SaveFileDialog")
     .def(py::init<std::string, std::string, std::vector<std::string>>(),
+         release_gil(),
          py::arg("title"),
          py::arg("default_path") = "",
          py::arg("filters") = std::vector<std::string>{ "All Files", "*" })
-    .def("result", &pfd::save_file::result)
-    .def("ready", &pfd::save_file::ready, py::arg("timeout") = pfd::internal::default_wait_timeout)
+    .def("result", &pfd::save_file::result, release_gil())
+    .def("ready", &pfd::save_file::ready, release_gil(), py::arg("timeout") = pfd::internal::default_wait_timeout)
     .def("kill", &pfd::save_file::kill);
 
   py::class_<pfd::select_folder>(m, "OpenFolderDialog")
-    .def(py::init<std::string, std::string>(), py::arg("title"), py::arg("default_path"))
-    .def("result", &pfd::select_folder::result)
-    .def("ready", &pfd::select_folder::ready, py::arg("timeout") = pfd::internal::default_wait_timeout)
+    .def(py::init<std::string, std::string>(), release_gil(), py::arg("title"), py::arg("default_path"))
+    .def("result", &pfd::select_folder::result, release_gil())
+    .def("ready", &pfd::select_folder::ready, release_gil(), py::arg("timeout") = pfd::internal::default_wait_timeout)
     .def("kill", &pfd::select_folder::kill);
 }
 
@@ -0,0 +1,172 @@
+#include <glow/cached_panel.hpp>
+
+#include <glow/gl_state.hpp>
+
+#include <imgui_impl_opengl3.h>
+
+#include <cmath>
+#include <cstdint>
+
+namespace glow {
+
+namespace {
+
+auto
+to_texture_id(const GLuint id) -> ImTextureID
+{
+  return reinterpret_cast<ImTextureID>(static_cast<std::uintptr_t>(id));
+}
+
+} // namespace
+
+cached_panel::cached_panel() = default;
+
+cached_panel::~cached_panel() = default;
+
+auto
+cached_panel::begin(const char* id, ImVec2 size, const std::uint64_t state_key) -> bool
+{
+  const auto avail = ImGui::GetContentRegionAvail();
+
+  if (size.x <= 0) {
+    size.x = avail.x;
+  }
+
+  if (size.y <= 0) {
+    size.y = avail.y;
+  }
+
+  const auto pos = ImGui::GetCursorScreenPos();
+
+  const bool moved = (pos.x != pos_.x) || (pos.y != pos_.y);
+
+  const bool resized = (size.x != size_.x) || (size.y != size_.y);
+
+  const bool hovered = ImGui::IsMouseHoveringRect(pos, ImVec2(pos.x + size.x, pos.y + size.y), false);
+
+  if (resized || (state_key != state_key_)) {
+    valid_ = false;
+  }
+
+  pos_ = pos;
+  size_ = size;
+  state_key_ = state_key;
+
+  // Clip rectangles are stored in screen space, so a panel that moves has to be captured again as well.
+
+  live_ = !valid_ || moved || hovered || focused_;
+
+  if (!live_) {
+    ImGui::Image(to_texture_id(target_->color_attachment()), size, ImVec2(0, 1), ImVec2(1, 0));
+    return false;
+  }
+
+  // While the panel is being interacted with, capturing every frame would be wasted work. The capture is deferred to
+  // the first frame where the panel would otherwise be drawn from the cache.
+
+  capture_pending_ = !(hovered || focused_);
+
+  valid_ = false;
+
+  ImGui::BeginChild(id, size);
+
+  return true;
+}
+
+void
+cached_panel::end()
+{
+  if (!live_) {
+    return;
+  }
+
+  focused_ = ImGui::IsWindowFocused(ImGuiFocusedFlags_ChildWindows) && ImGui::IsAnyItemActive();
+
+  auto* draw_list = ImGui::GetWindowDrawList();
+
+  ImGui::EndChild();
+
+  if (capture_pending_) {
+    capture(draw_list);
+  }
+}
+
+void
+cached_panel::capture(ImDrawList* draw_list)
+{
+  const auto& io = ImGui::GetIO();
+
+  const auto fb_w = static_cast<GLsizei>(std::lround(size_.x * io.DisplayFramebufferScale.x));
+  const auto fb_h = static_cast<GLsizei>(std::lround(size_.y * io.DisplayFramebufferScale.y));
+
+  if ((fb_w <= 0) || (fb_h <= 0)) {
+    return;
+  }
+
+  if (!target_ || (target_->width() != fb_w) || (target_->height() != fb_h)) {
+    target_ = std::make_unique<framebuffer>(fb_w, fb_h);
+  }
+
+  auto& state = gl_state::current();
+
+  const auto previous_fb = state.draw_framebuffer();
+
+  target_->bind();
+
+  // The texture is drawn over the panel with regular alpha blending, so it is cleared to an opaque background in
+  // order to avoid blending the translucent parts twice.
+
+  auto bg = ImGui::GetStyle().Colors[ImGuiCol_WindowBg];
+
+  // The hosts set the clear color once and clear the window with it every frame, so it is put back afterwards.
+  GLfloat previous_clear_color[4]{};
+
+  glGetFloatv(GL_COLOR_CLEAR_VALUE, previous_clear_color);
+
+  glClearColor(bg.x, bg.y, bg.z, 1.0f);
+
+  glClear(GL_COLOR_BUFFER_BIT);
+
+  glClearColor(previous_clear_color[0], previous_clear_color[1], previous_clear_color[2], previous_clear_color[3]);
+
+  ImDrawData draw_data;
+  draw_data.Valid = true;
+  draw_data.CmdLists.push_back(draw_list);
+  draw_data.CmdListsCount = 1;
+  draw_data.TotalVtxCount = draw_list->VtxBuffer.Size;
+  draw_data.TotalIdxCount = draw_list->IdxBuffer.Size;
+  draw_data.DisplayPos = pos_;
+  draw_data.DisplaySize = size_;
+  draw_data.FramebufferScale = io.DisplayFramebufferScale;
+
+  ImGui_ImplOpenGL3_RenderDrawData(&draw_data);
+
+  // The backend changes state without going through the cache.
+  state.invalidate();
+
+  state.bind_framebuffer(GL_FRAMEBUFFER, previous_fb);
+
+  valid_ = true;
+
+  capture_count_++;
+}
+
+void
+cached_panel::invalidate()
+{
+  valid_ = false;
+}
+
+auto
+cached_panel::is_cached() const -> bool
+{
+  return !live_;
+}
+
+auto
+cached_panel::capture_count() const -> std::uint64_t
+{
+  return capture_count_;
+}
+
+} // namespace glow
@@ -1,30 +1,82 @@
 #include <glow/framebuffer.hpp>
 
+#include <glow/gl_state.hpp>
+
+#include "gl_formats.h"
+
 namespace glow {
 
+auto
+framebuffer_format::operator==(const framebuffer_format& other) const -> bool
+{
+  return (internal_format == other.internal_format) && (format == other.format) && (type == other.type) &&
+         (min_filter == other.min_filter) && (mag_filter == other.mag_filter) && (depth == other.depth);
+}
+
+auto
+framebuffer_format::operator!=(const framebuffer_format& other) const -> bool
+{
+  return !(*this == other);
+}
+
+auto
+framebuffer_format::texel_size() const -> std::size_t
+{
+  const std::size_t depth_size = depth ? 4 : 0;
+
+  return glow::texel_size(internal_format, format, type) + depth_size;
+}
+
 framebuffer::framebuffer(const GLsizei width, const GLsizei height)
+  : framebuffer(width, height, framebuffer_format{})
+{
+}
+
+framebuffer::framebuffer(const GLsizei width, const GLsizei height, const framebuffer_format& format)
   : width_(width)
   , height_(height)
+  , format_(format)
 {
+  auto& state = gl_state::current();
+
   glGenTextures(1, &color_attachment_);
-  glBindTexture(GL_TEXTURE_2D, color_attachment_);
+  state.bind_texture(GL_TEXTURE_2D, color_attachment_);
   glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
   glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-  glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, format.min_filter);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, format.mag_filter);
+  glTexImage2D(GL_TEXTURE_2D, 0, format.internal_format, width, height, 0, format.format, format.type, nullptr);
 
   glGenFramebuffers(1, &id_);
-  glBindFramebuffer(GL_FRAMEBUFFER, id_);
+  state.bind_framebuffer(GL_FRAMEBUFFER, id_);
   glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, color_attachment_, 0);
+
+  if (format.depth) {
+    glGenRenderbuffers(1, &depth_attachment_);
+    glBindRenderbuffer(GL_RENDERBUFFER, depth_attachment_);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, width, height);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, depth_attachment_);
+  }
+
   status_ = glCheckFramebufferStatus(GL_FRAMEBUFFER);
-  glBindFramebuffer(GL_FRAMEBUFFER, 0);
+  state.bind_framebuffer(GL_FRAMEBUFFER, 0);
 }
 
 framebuffer::~framebuffer()
 {
+  auto& state = gl_state::current();
+
+  state.forget_framebuffer(id_);
+
+  state.forget_texture(color_attachment_);
+
   glDeleteFramebuffers(1, &id_);
 
+  if (depth_attachment_) {
+    glDeleteRenderbuffers(1, &depth_attachment_);
+  }
+
   glDeleteTextures(1, &color_attachment_);
 }
 
@@ -34,6 +86,12 @@ framebuffer::status() const -> GLenum
   return status_;
 }
 
+void
+framebuffer::bind(const GLenum target)
+{
+  gl_state::current().bind_framebuffer(target, id_);
+}
+
 auto
 framebuffer::color_attachment() -> GLuint
 {
@@ -52,4 +110,16 @@ framebuffer::height() const -> GLsizei
   return height_;
 }
 
+auto
+framebuffer::format() const -> const framebuffer_format&
+{
+  return format_;
+}
+
+auto
+framebuffer::memory_size() const -> std::size_t
+{
+  return static_cast<std::size_t>(width_) * static_cast<std::size_t>(height_) * format_.texel_size();
+}
+
 } // namespace glow
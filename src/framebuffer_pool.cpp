@@ -0,0 +1,108 @@
+#include <glow/framebuffer_pool.hpp>
+
+#include <algorithm>
+
+namespace glow {
+
+framebuffer_pool::framebuffer_pool(const std::uint32_t max_idle_frames)
+  : max_idle_frames_(max_idle_frames)
+{
+}
+
+framebuffer_pool::~framebuffer_pool() = default;
+
+auto
+framebuffer_pool::acquire(const GLsizei width, const GLsizei height, const framebuffer_format& format) -> framebuffer&
+{
+  for (auto& e : entries_) {
+
+    if (e.in_use) {
+      continue;
+    }
+
+    auto& target = *e.target;
+
+    if ((target.width() == width) && (target.height() == height) && (target.format() == format)) {
+      e.in_use = true;
+      e.last_used_frame = frame_;
+      return target;
+    }
+  }
+
+  entry e;
+  e.target = std::make_unique<framebuffer>(width, height, format);
+  e.last_used_frame = frame_;
+  e.in_use = true;
+
+  allocation_count_++;
+
+  entries_.emplace_back(std::move(e));
+
+  return *entries_.back().target;
+}
+
+void
+framebuffer_pool::release(const framebuffer& target)
+{
+  for (auto& e : entries_) {
+    if (e.target.get() == &target) {
+      e.in_use = false;
+      return;
+    }
+  }
+}
+
+void
+framebuffer_pool::next_frame()
+{
+  frame_++;
+
+  const auto expired = [this](const entry& e) -> bool {
+    return (frame_ - e.last_used_frame) > static_cast<std::uint64_t>(max_idle_frames_);
+  };
+
+  entries_.erase(std::remove_if(entries_.begin(), entries_.end(), expired), entries_.end());
+
+  for (auto& e : entries_) {
+    e.in_use = false;
+  }
+}
+
+void
+framebuffer_pool::trim()
+{
+  entries_.erase(std::remove_if(entries_.begin(), entries_.end(), [](const entry& e) { return !e.in_use; }),
+                 entries_.end());
+}
+
+void
+framebuffer_pool::set_max_idle_frames(const std::uint32_t max_idle_frames)
+{
+  max_idle_frames_ = max_idle_frames;
+}
+
+auto
+framebuffer_pool::memory_usage() const -> std::size_t
+{
+  std::size_t total{};
+
+  for (const auto& e : entries_) {
+    total += e.target->memory_size();
+  }
+
+  return total;
+}
+
+auto
+framebuffer_pool::size() const -> std::size_t
+{
+  return entries_.size();
+}
+
+auto
+framebuffer_pool::allocation_count() const -> std::size_t
+{
+  return allocation_count_;
+}
+
+} // namespace glow
@@ -0,0 +1,64 @@
+#include <glow/gl_capabilities.hpp>
+
+#include <GLES3/gl3.h>
+
+#include <cstdio>
+#include <cstring>
+
+#include "gl_extensions.h"
+
+namespace glow {
+
+namespace {
+
+auto
+get_int(const GLenum name) -> int
+{
+  GLint value{ 0 };
+
+  glGetIntegerv(name, &value);
+
+  return static_cast<int>(value);
+}
+
+} // namespace
+
+auto
+query_gl_capabilities() -> gl_capabilities
+{
+  gl_capabilities caps;
+
+  const auto* version = reinterpret_cast<const char*>(glGetString(GL_VERSION));
+
+  if (version) {
+    // ES contexts report "OpenGL ES <major>.<minor> ...", including WebGL ones ("OpenGL ES 3.0 (WebGL 2.0)").
+    const auto* numbers = std::strstr(version, "OpenGL ES ");
+    if (numbers) {
+      std::sscanf(numbers + 10, "%d.%d", &caps.major_version, &caps.minor_version);
+    }
+    caps.webgl = std::strstr(version, "WebGL") != nullptr;
+  }
+
+  caps.max_texture_size = get_int(GL_MAX_TEXTURE_SIZE);
+
+  if (!caps.at_least(3, 0)) {
+    // The loader only covers the core ES 3.0 entry points, so ES 2.0 extensions that add entry points are not
+    // reported here, even if the driver advertises them.
+    return caps;
+  }
+
+  caps.instancing = true;
+  caps.pixel_buffer_objects = true;
+  caps.multiple_render_targets = true;
+  caps.uniform_buffers = true;
+  caps.sized_texture_formats = true;
+  caps.program_binaries = get_int(GL_NUM_PROGRAM_BINARY_FORMATS) > 0;
+
+  caps.max_draw_buffers = get_int(GL_MAX_DRAW_BUFFERS);
+  caps.max_uniform_block_size = get_int(GL_MAX_UNIFORM_BLOCK_SIZE);
+  caps.max_samples = get_int(GL_MAX_SAMPLES);
+
+  return caps;
+}
+
+} // namespace glow
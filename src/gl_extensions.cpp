@@ -0,0 +1,62 @@
+#include "gl_extensions.h"
+
+#include <GLES3/gl3.h>
+
+#include <cstring>
+
+namespace glow {
+
+auto
+is_es3_context() -> bool
+{
+  // The context version does not change once the context is created, so the string is only parsed once. Nothing is
+  // cached while no context is current, since glGetString returns null until then.
+  static int cached{ -1 };
+
+  if (cached < 0) {
+
+    const auto* version = reinterpret_cast<const char*>(glGetString(GL_VERSION));
+    if (!version) {
+      return false;
+    }
+
+    const auto* numbers = std::strstr(version, "OpenGL ES ");
+
+    cached = (numbers && (numbers[10] >= '3') && (numbers[10] <= '9')) ? 1 : 0;
+  }
+
+  return cached == 1;
+}
+
+auto
+has_gl_extension(const char* name) -> bool
+{
+  if (!is_es3_context()) {
+    // glGetStringi does not exist on ES 2.0, so search the space separated list instead.
+    const auto* list = reinterpret_cast<const char*>(glGetString(GL_EXTENSIONS));
+    const auto length = std::strlen(name);
+    for (const auto* p = list ? std::strstr(list, name) : nullptr; p; p = std::strstr(p + length, name)) {
+      const bool starts = (p == list) || (p[-1] == ' ');
+      const bool ends = (p[length] == ' ') || (p[length] == '\0');
+      if (starts && ends) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  GLint count{ 0 };
+
+  glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+
+  for (GLint i = 0; i < count; i++) {
+    const auto* ext = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, static_cast<GLuint>(i)));
+    if (ext && (std::strcmp(ext, name) == 0)) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+} // namespace glow
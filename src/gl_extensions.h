@@ -0,0 +1,15 @@
+#pragma once
+
+namespace glow {
+
+/// @brief Checks whether the current context is an OpenGL ES 3.0 (or WebGL 2) context or newer.
+///
+/// @note Entry points that were added in ES 3.0 are null on older contexts, even if an extension string names them.
+auto
+is_es3_context() -> bool;
+
+/// @brief Checks whether the current context advertises an extension.
+auto
+has_gl_extension(const char* name) -> bool;
+
+} // namespace glow
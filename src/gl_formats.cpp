@@ -0,0 +1,128 @@
+#include "gl_formats.h"
+
+namespace glow {
+
+auto
+channel_count(const GLenum format) -> std::size_t
+{
+  switch (format) {
+    case GL_RED:
+    case GL_RED_INTEGER:
+    case GL_ALPHA:
+    case GL_LUMINANCE:
+    case GL_DEPTH_COMPONENT:
+      return 1;
+    case GL_RG:
+    case GL_RG_INTEGER:
+    case GL_LUMINANCE_ALPHA:
+    case GL_DEPTH_STENCIL:
+      return 2;
+    case GL_RGB:
+    case GL_RGB_INTEGER:
+      return 3;
+    default:
+      return 4;
+  }
+}
+
+auto
+pixel_size(const GLenum format, const GLenum type) -> std::size_t
+{
+  switch (type) {
+    case GL_UNSIGNED_SHORT_5_6_5:
+    case GL_UNSIGNED_SHORT_4_4_4_4:
+    case GL_UNSIGNED_SHORT_5_5_5_1:
+      return 2;
+    case GL_UNSIGNED_INT_2_10_10_10_REV:
+    case GL_UNSIGNED_INT_10F_11F_11F_REV:
+    case GL_UNSIGNED_INT_5_9_9_9_REV:
+    case GL_UNSIGNED_INT_24_8:
+      return 4;
+    case GL_HALF_FLOAT:
+    case GL_SHORT:
+    case GL_UNSIGNED_SHORT:
+      return 2 * channel_count(format);
+    case GL_FLOAT:
+    case GL_INT:
+    case GL_UNSIGNED_INT:
+      return 4 * channel_count(format);
+    default:
+      return channel_count(format);
+  }
+}
+
+auto
+texel_size(const GLint internal_format, const GLenum format, const GLenum type) -> std::size_t
+{
+  switch (internal_format) {
+    case GL_R8:
+    case GL_R8_SNORM:
+    case GL_R8I:
+    case GL_R8UI:
+    case GL_ALPHA:
+    case GL_LUMINANCE:
+      return 1;
+    case GL_R16F:
+    case GL_R16I:
+    case GL_R16UI:
+    case GL_RG8:
+    case GL_RG8_SNORM:
+    case GL_RG8I:
+    case GL_RG8UI:
+    case GL_RGB565:
+    case GL_RGBA4:
+    case GL_RGB5_A1:
+    case GL_LUMINANCE_ALPHA:
+    case GL_DEPTH_COMPONENT16:
+      return 2;
+    case GL_RGB8:
+    case GL_SRGB8:
+    case GL_RGB8_SNORM:
+    case GL_RGB8I:
+    case GL_RGB8UI:
+    case GL_DEPTH_COMPONENT24:
+      return 3;
+    case GL_R32F:
+    case GL_R32I:
+    case GL_R32UI:
+    case GL_RG16F:
+    case GL_RG16I:
+    case GL_RG16UI:
+    case GL_RGBA8:
+    case GL_SRGB8_ALPHA8:
+    case GL_RGBA8_SNORM:
+    case GL_RGBA8I:
+    case GL_RGBA8UI:
+    case GL_RGB10_A2:
+    case GL_RGB10_A2UI:
+    case GL_R11F_G11F_B10F:
+    case GL_RGB9_E5:
+    case GL_DEPTH_COMPONENT32F:
+    case GL_DEPTH24_STENCIL8:
+      return 4;
+    case GL_RGB16F:
+    case GL_RGB16I:
+    case GL_RGB16UI:
+      return 6;
+    case GL_RG32F:
+    case GL_RG32I:
+    case GL_RG32UI:
+    case GL_RGBA16F:
+    case GL_RGBA16I:
+    case GL_RGBA16UI:
+    case GL_DEPTH32F_STENCIL8:
+      return 8;
+    case GL_RGB32F:
+    case GL_RGB32I:
+    case GL_RGB32UI:
+      return 12;
+    case GL_RGBA32F:
+    case GL_RGBA32I:
+    case GL_RGBA32UI:
+      return 16;
+    default:
+      return pixel_size(format, type);
+  }
+}
+
+} // namespace glow
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <GLES3/gl3.h>
+
+#include <cstddef>
+
+namespace glow {
+
+/// @brief Gets the number of components in a pixel transfer format.
+auto
+channel_count(GLenum format) -> std::size_t;
+
+/// @brief Gets the size, in bytes, of one pixel with the given transfer format and type.
+auto
+pixel_size(GLenum format, GLenum type) -> std::size_t;
+
+/// @brief Gets the size, in bytes, that one texel of a texture takes in GPU memory.
+///
+/// @details The size comes from the internal format when it is a sized one, since the transfer type may be wider (for
+///          example, @c GL_RGBA16F textures can be uploaded from @c GL_FLOAT data). Unsized internal formats fall back
+///          to the size of the transfer format and type.
+auto
+texel_size(GLint internal_format, GLenum format, GLenum type) -> std::size_t;
+
+} // namespace glow
@@ -0,0 +1,388 @@
+#include <glow/gl_state.hpp>
+
+namespace glow {
+
+namespace {
+
+auto
+texture_target_index(const GLenum target) -> int
+{
+  switch (target) {
+    case GL_TEXTURE_2D:
+      return 0;
+    case GL_TEXTURE_CUBE_MAP:
+      return 1;
+    case GL_TEXTURE_3D:
+      return 2;
+    case GL_TEXTURE_2D_ARRAY:
+      return 3;
+    default:
+      return -1;
+  }
+}
+
+auto
+buffer_target_index(const GLenum target) -> int
+{
+  switch (target) {
+    case GL_ARRAY_BUFFER:
+      return 0;
+    case GL_ELEMENT_ARRAY_BUFFER:
+      return 1;
+    case GL_UNIFORM_BUFFER:
+      return 2;
+    case GL_PIXEL_PACK_BUFFER:
+      return 3;
+    case GL_PIXEL_UNPACK_BUFFER:
+      return 4;
+    case GL_COPY_READ_BUFFER:
+      return 5;
+    case GL_COPY_WRITE_BUFFER:
+      return 6;
+    case GL_TRANSFORM_FEEDBACK_BUFFER:
+      return 7;
+    default:
+      return -1;
+  }
+}
+
+auto
+capability_index(const GLenum capability) -> int
+{
+  switch (capability) {
+    case GL_BLEND:
+      return 0;
+    case GL_CULL_FACE:
+      return 1;
+    case GL_DEPTH_TEST:
+      return 2;
+    case GL_SCISSOR_TEST:
+      return 3;
+    case GL_STENCIL_TEST:
+      return 4;
+    case GL_DITHER:
+      return 5;
+    case GL_POLYGON_OFFSET_FILL:
+      return 6;
+    case GL_SAMPLE_ALPHA_TO_COVERAGE:
+      return 7;
+    case GL_SAMPLE_COVERAGE:
+      return 8;
+    case GL_RASTERIZER_DISCARD:
+      return 9;
+    case GL_PRIMITIVE_RESTART_FIXED_INDEX:
+      return 10;
+    default:
+      return -1;
+  }
+}
+
+} // namespace
+
+auto
+gl_state::current() -> gl_state&
+{
+  thread_local gl_state state;
+
+  return state;
+}
+
+gl_state::gl_state() = default;
+
+template<typename T>
+auto
+gl_state::update(slot<T>& s, const T& value) -> bool
+{
+  if (s.known && (s.value == value)) {
+    skip_count_++;
+    return false;
+  }
+
+  s.value = value;
+  s.known = true;
+
+  call_count_++;
+
+  return true;
+}
+
+void
+gl_state::invalidate()
+{
+  program_.known = false;
+
+  active_texture_.known = false;
+
+  for (auto& unit : textures_) {
+    for (auto& t : unit) {
+      t.known = false;
+    }
+  }
+
+  for (auto& b : buffers_) {
+    b.known = false;
+  }
+
+  vertex_array_.known = false;
+
+  draw_framebuffer_.known = false;
+
+  read_framebuffer_.known = false;
+
+  for (auto& c : capabilities_) {
+    c.known = false;
+  }
+
+  blend_func_.known = false;
+
+  viewport_.known = false;
+
+  scissor_.known = false;
+}
+
+void
+gl_state::use_program(const GLuint program)
+{
+  if (update(program_, program)) {
+    glUseProgram(program);
+  }
+}
+
+void
+gl_state::active_texture(const GLuint unit)
+{
+  if (update(active_texture_, unit)) {
+    glActiveTexture(GL_TEXTURE0 + unit);
+  }
+}
+
+void
+gl_state::bind_texture(const GLenum target, const GLuint texture)
+{
+  const auto index = texture_target_index(target);
+
+  if (!active_texture_.known || (active_texture_.value >= max_texture_units) || (index < 0)) {
+    call_count_++;
+    glBindTexture(target, texture);
+    return;
+  }
+
+  if (update(textures_[active_texture_.value][static_cast<std::size_t>(index)], texture)) {
+    glBindTexture(target, texture);
+  }
+}
+
+void
+gl_state::bind_texture(const GLuint unit, const GLenum target, const GLuint texture)
+{
+  active_texture(unit);
+
+  bind_texture(target, texture);
+}
+
+void
+gl_state::bind_buffer(const GLenum target, const GLuint buffer)
+{
+  const auto index = buffer_target_index(target);
+
+  if (index < 0) {
+    call_count_++;
+    glBindBuffer(target, buffer);
+    return;
+  }
+
+  if (update(buffers_[static_cast<std::size_t>(index)], buffer)) {
+    glBindBuffer(target, buffer);
+  }
+}
+
+void
+gl_state::bind_buffer_range(const GLenum target,
+                            const GLuint index,
+                            const GLuint buffer,
+                            const GLintptr offset,
+                            const GLsizeiptr size)
+{
+  call_count_++;
+
+  glBindBufferRange(target, index, buffer, offset, size);
+
+  const auto generic = buffer_target_index(target);
+  if (generic >= 0) {
+    buffers_[static_cast<std::size_t>(generic)] = slot<GLuint>{ buffer, true };
+  }
+}
+
+void
+gl_state::bind_vertex_array(const GLuint vertex_array)
+{
+  if (update(vertex_array_, vertex_array)) {
+    glBindVertexArray(vertex_array);
+    // The element array binding belongs to the vertex array.
+    buffers_[1].known = false;
+  }
+}
+
+void
+gl_state::bind_framebuffer(const GLenum target, const GLuint framebuffer)
+{
+  if (target == GL_FRAMEBUFFER) {
+    if (draw_framebuffer_.known && read_framebuffer_.known && (draw_framebuffer_.value == framebuffer) &&
+        (read_framebuffer_.value == framebuffer)) {
+      skip_count_++;
+      return;
+    }
+    draw_framebuffer_ = slot<GLuint>{ framebuffer, true };
+    read_framebuffer_ = slot<GLuint>{ framebuffer, true };
+    call_count_++;
+    glBindFramebuffer(target, framebuffer);
+    return;
+  }
+
+  auto& s = (target == GL_READ_FRAMEBUFFER) ? read_framebuffer_ : draw_framebuffer_;
+
+  if (update(s, framebuffer)) {
+    glBindFramebuffer(target, framebuffer);
+  }
+}
+
+void
+gl_state::enable(const GLenum capability)
+{
+  set_enabled(capability, true);
+}
+
+void
+gl_state::disable(const GLenum capability)
+{
+  set_enabled(capability, false);
+}
+
+void
+gl_state::set_enabled(const GLenum capability, const bool enabled)
+{
+  const auto index = capability_index(capability);
+
+  if ((index >= 0) && !update(capabilities_[static_cast<std::size_t>(index)], enabled)) {
+    return;
+  }
+
+  if (index < 0) {
+    call_count_++;
+  }
+
+  if (enabled) {
+    glEnable(capability);
+  } else {
+    glDisable(capability);
+  }
+}
+
+void
+gl_state::blend_func(const GLenum src, const GLenum dst)
+{
+  blend_func_separate(src, dst, src, dst);
+}
+
+void
+gl_state::blend_func_separate(const GLenum src_rgb,
+                              const GLenum dst_rgb,
+                              const GLenum src_alpha,
+                              const GLenum dst_alpha)
+{
+  if (update(blend_func_, std::array<GLenum, 4>{ src_rgb, dst_rgb, src_alpha, dst_alpha })) {
+    glBlendFuncSeparate(src_rgb, dst_rgb, src_alpha, dst_alpha);
+  }
+}
+
+void
+gl_state::viewport(const GLint x, const GLint y, const GLsizei w, const GLsizei h)
+{
+  if (update(viewport_, std::array<GLint, 4>{ x, y, w, h })) {
+    glViewport(x, y, w, h);
+  }
+}
+
+void
+gl_state::scissor(const GLint x, const GLint y, const GLsizei w, const GLsizei h)
+{
+  if (update(scissor_, std::array<GLint, 4>{ x, y, w, h })) {
+    glScissor(x, y, w, h);
+  }
+}
+
+auto
+gl_state::draw_framebuffer() -> GLuint
+{
+  if (!draw_framebuffer_.known) {
+    GLint id{ 0 };
+    glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &id);
+    draw_framebuffer_ = slot<GLuint>{ static_cast<GLuint>(id), true };
+  }
+
+  return draw_framebuffer_.value;
+}
+
+void
+gl_state::forget_program(const GLuint program)
+{
+  if (program_.value == program) {
+    program_.known = false;
+  }
+}
+
+void
+gl_state::forget_texture(const GLuint texture)
+{
+  for (auto& unit : textures_) {
+    for (auto& t : unit) {
+      if (t.value == texture) {
+        t.known = false;
+      }
+    }
+  }
+}
+
+void
+gl_state::forget_buffer(const GLuint buffer)
+{
+  for (auto& b : buffers_) {
+    if (b.value == buffer) {
+      b.known = false;
+    }
+  }
+}
+
+void
+gl_state::forget_vertex_array(const GLuint vertex_array)
+{
+  if (vertex_array_.value == vertex_array) {
+    vertex_array_.known = false;
+  }
+}
+
+void
+gl_state::forget_framebuffer(const GLuint framebuffer)
+{
+  if (draw_framebuffer_.value == framebuffer) {
+    draw_framebuffer_.known = false;
+  }
+
+  if (read_framebuffer_.value == framebuffer) {
+    read_framebuffer_.known = false;
+  }
+}
+
+auto
+gl_state::call_count() const -> std::size_t
+{
+  return call_count_;
+}
+
+auto
+gl_state::skip_count() const -> std::size_t
+{
+  return skip_count_;
+}
+
+} // namespace glow
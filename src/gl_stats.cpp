@@ -0,0 +1,240 @@
+#include <glow/gl_stats.hpp>
+
+#include <GLES3/gl3.h>
+
+#include <unordered_map>
+
+#include <cstdarg>
+#include <cstring>
+
+#include "gl_formats.h"
+
+namespace glow {
+
+namespace {
+
+gl_call_stats current_frame;
+
+gl_call_stats last_frame;
+
+#ifdef GLAD_DEBUG
+
+enum class call_kind
+{
+  other,
+  draw,
+  state_change,
+  /// @brief A texture upload whose size is given by width, height, depth, format and type arguments.
+  texture_upload,
+  /// @brief A compressed texture upload whose size is given by an image size argument.
+  compressed_texture_upload,
+  buffer_data,
+  buffer_sub_data,
+  get_error
+};
+
+struct call_info final
+{
+  call_kind kind{ call_kind::other };
+
+  /// @brief The number of 32-bit integer arguments that come before the data pointer.
+  int int_args{ 0 };
+
+  /// @brief The indices of the width, height and depth arguments (-1 if not present).
+  int size_args[3]{ -1, -1, -1 };
+
+  /// @brief The index of the format argument, or of the image size argument for compressed uploads.
+  int format_arg{ -1 };
+
+  int type_arg{ -1 };
+};
+
+auto
+starts_with(const char* str, const char* prefix) -> bool
+{
+  return std::strncmp(str, prefix, std::strlen(prefix)) == 0;
+}
+
+auto
+classify(const char* name) -> call_info
+{
+  // clang-format off
+  struct upload final { const char* name; call_info info; };
+  static const upload uploads[] = {
+    { "glTexImage2D",              { call_kind::texture_upload,            8,  { 3, 4, -1 }, 6, 7 } },
+    { "glTexSubImage2D",           { call_kind::texture_upload,            8,  { 4, 5, -1 }, 6, 7 } },
+    { "glTexImage3D",              { call_kind::texture_upload,            9,  { 3, 4, 5 },  7, 8 } },
+    { "glTexSubImage3D",           { call_kind::texture_upload,            10, { 5, 6, 7 },  8, 9 } },
+    { "glCompressedTexImage2D",    { call_kind::compressed_texture_upload, 7,  {},           6    } },
+    { "glCompressedTexSubImage2D", { call_kind::compressed_texture_upload, 8,  {},           7    } },
+    { "glCompressedTexImage3D",    { call_kind::compressed_texture_upload, 8,  {},           7    } },
+    { "glCompressedTexSubImage3D", { call_kind::compressed_texture_upload, 10, {},           9    } },
+  };
+  static const char* const state_prefixes[] = {
+    "glBind", "glUseProgram", "glActiveTexture", "glEnable", "glDisable", "glBlend", "glViewport", "glScissor",
+    "glDepthFunc", "glDepthMask", "glDepthRange", "glColorMask", "glCullFace", "glFrontFace", "glStencil",
+    "glPolygonOffset", "glLineWidth", "glPixelStore", "glVertexAttribPointer", "glVertexAttribIPointer",
+    "glVertexAttribDivisor", "glDrawBuffers", "glReadBuffer", "glClearColor", "glClearDepth", "glClearStencil",
+  };
+  // clang-format on
+
+  for (const auto& u : uploads) {
+    if (std::strcmp(name, u.name) == 0) {
+      return u.info;
+    }
+  }
+
+  call_info info;
+
+  if (std::strcmp(name, "glGetError") == 0) {
+    info.kind = call_kind::get_error;
+  } else if (std::strcmp(name, "glBufferData") == 0) {
+    info.kind = call_kind::buffer_data;
+  } else if (std::strcmp(name, "glBufferSubData") == 0) {
+    info.kind = call_kind::buffer_sub_data;
+  } else if (starts_with(name, "glDraw") && (std::strcmp(name, "glDrawBuffers") != 0)) {
+    info.kind = call_kind::draw;
+  } else {
+    for (const auto* prefix : state_prefixes) {
+      if (starts_with(name, prefix)) {
+        info.kind = call_kind::state_change;
+        break;
+      }
+    }
+  }
+
+  return info;
+}
+
+void
+count_texture_upload(const call_info& info, va_list args)
+{
+  int values[10]{};
+
+  for (int i = 0; i < info.int_args; i++) {
+    values[i] = va_arg(args, int);
+  }
+
+  const auto* data = va_arg(args, const void*);
+
+  // Without data, the call only allocates storage (or reads from a bound unpack buffer, which is not tracked here).
+  if (!data) {
+    return;
+  }
+
+  if (info.kind == call_kind::compressed_texture_upload) {
+    current_frame.texture_upload_bytes += static_cast<std::size_t>(values[info.format_arg]);
+    return;
+  }
+
+  const auto format = static_cast<GLenum>(values[info.format_arg]);
+
+  const auto type = static_cast<GLenum>(values[info.type_arg]);
+
+  auto bytes = pixel_size(format, type);
+
+  for (const auto index : info.size_args) {
+    if (index >= 0) {
+      bytes *= static_cast<std::size_t>(values[index]);
+    }
+  }
+
+  current_frame.texture_upload_bytes += bytes;
+}
+
+void
+pre_call(const char* name, void* funcptr, int len_args, ...)
+{
+  static std::unordered_map<void*, call_info> infos;
+
+  auto it = infos.find(funcptr);
+  if (it == infos.end()) {
+    it = infos.emplace(funcptr, classify(name)).first;
+  }
+
+  const auto& info = it->second;
+
+  current_frame.calls++;
+
+  va_list args;
+
+  switch (info.kind) {
+    case call_kind::other:
+      break;
+    case call_kind::draw:
+      current_frame.draw_calls++;
+      break;
+    case call_kind::state_change:
+      current_frame.state_changes++;
+      break;
+    case call_kind::texture_upload:
+    case call_kind::compressed_texture_upload:
+      va_start(args, len_args);
+      count_texture_upload(info, args);
+      va_end(args);
+      break;
+    case call_kind::buffer_data:
+    case call_kind::buffer_sub_data:
+      va_start(args, len_args);
+      va_arg(args, GLenum);
+      if (info.kind == call_kind::buffer_sub_data) {
+        va_arg(args, GLintptr);
+      }
+      {
+        const auto size = va_arg(args, GLsizeiptr);
+        const auto* data = va_arg(args, const void*);
+        if (data) {
+          current_frame.buffer_upload_bytes += static_cast<std::size_t>(size);
+        }
+      }
+      va_end(args);
+      break;
+    case call_kind::get_error:
+      current_frame.error_checks++;
+      break;
+  }
+}
+
+void
+post_call(const char*, void*, int, ...)
+{
+}
+
+#endif // GLAD_DEBUG
+
+} // namespace
+
+auto
+gl_call_stats_available() -> bool
+{
+#ifdef GLAD_DEBUG
+  return true;
+#else
+  return false;
+#endif
+}
+
+void
+install_gl_call_hooks()
+{
+#ifdef GLAD_DEBUG
+  glad_set_pre_callback(pre_call);
+  glad_set_post_callback(post_call);
+#endif
+}
+
+void
+end_gl_call_stats_frame()
+{
+  last_frame = current_frame;
+
+  current_frame = gl_call_stats{};
+}
+
+auto
+get_gl_call_stats() -> gl_call_stats
+{
+  return last_frame;
+}
+
+} // namespace glow
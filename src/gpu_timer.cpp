@@ -0,0 +1,107 @@
+#include <glow/gpu_timer.hpp>
+
+#include "gl_extensions.h"
+
+#ifndef GL_TIME_ELAPSED_EXT
+#define GL_TIME_ELAPSED_EXT 0x88BF
+#endif
+
+#ifndef GL_GPU_DISJOINT_EXT
+#define GL_GPU_DISJOINT_EXT 0x8FBB
+#endif
+
+namespace glow {
+
+gpu_timer::gpu_timer()
+  : supported_(is_es3_context() && (has_gl_extension("GL_EXT_disjoint_timer_query") ||
+                                    has_gl_extension("GL_EXT_disjoint_timer_query_webgl2")))
+{
+  if (supported_) {
+    glGenQueries(static_cast<GLsizei>(query_count), queries_);
+  }
+}
+
+gpu_timer::~gpu_timer()
+{
+  if (supported_) {
+    glDeleteQueries(static_cast<GLsizei>(query_count), queries_);
+  }
+}
+
+auto
+gpu_timer::supported() const -> bool
+{
+  return supported_;
+}
+
+void
+gpu_timer::begin()
+{
+  if (!supported_ || active_ || (in_flight_ == query_count)) {
+    return;
+  }
+
+  glBeginQuery(GL_TIME_ELAPSED_EXT, queries_[head_]);
+
+  active_ = true;
+}
+
+void
+gpu_timer::end()
+{
+  if (!active_) {
+    return;
+  }
+
+  glEndQuery(GL_TIME_ELAPSED_EXT);
+
+  head_ = (head_ + 1) % query_count;
+
+  in_flight_++;
+
+  active_ = false;
+}
+
+auto
+gpu_timer::poll() -> bool
+{
+  bool updated{ false };
+
+  while (in_flight_ > 0) {
+
+    const auto oldest = (head_ + query_count - in_flight_) % query_count;
+
+    GLuint available{ GL_FALSE };
+
+    glGetQueryObjectuiv(queries_[oldest], GL_QUERY_RESULT_AVAILABLE, &available);
+
+    if (available != GL_TRUE) {
+      break;
+    }
+
+    GLuint elapsed_ns{ 0 };
+
+    glGetQueryObjectuiv(queries_[oldest], GL_QUERY_RESULT, &elapsed_ns);
+
+    in_flight_--;
+
+    GLint disjoint{ GL_FALSE };
+
+    glGetIntegerv(GL_GPU_DISJOINT_EXT, &disjoint);
+
+    if (disjoint == GL_FALSE) {
+      elapsed_ms_ = static_cast<float>(elapsed_ns) * 1.0e-6f;
+      updated = true;
+    }
+  }
+
+  return updated;
+}
+
+auto
+gpu_timer::elapsed_ms() const -> float
+{
+  return elapsed_ms_;
+}
+
+} // namespace glow
@@ -0,0 +1,333 @@
+#include <glow/line_decimator.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace glow {
+
+namespace {
+
+/// @brief The number of samples summarized by each block.
+constexpr std::size_t block_size{ 256 };
+
+constexpr auto no_index = std::numeric_limits<std::size_t>::max();
+
+template<typename T>
+auto
+element(const T* base, const std::size_t index, const int stride) -> const T*
+{
+  const auto* bytes = reinterpret_cast<const unsigned char*>(base);
+  return reinterpret_cast<const T*>(bytes + index * static_cast<std::size_t>(stride));
+}
+
+template<typename T>
+auto
+load(const T* base, const std::size_t index, const int stride) -> double
+{
+  return static_cast<double>(*element(base, index, stride));
+}
+
+/// @brief Finds the first index in [first, last) for which the predicate is false.
+template<typename Predicate>
+auto
+partition_point(std::size_t first, std::size_t last, Predicate pred) -> std::size_t
+{
+  while (first < last) {
+    const auto middle = first + (last - first) / 2;
+    if (pred(middle)) {
+      first = middle + 1;
+    } else {
+      last = middle;
+    }
+  }
+  return first;
+}
+
+/// @brief Converts a position on the x axis to the index of the first sample at or after it, for uniform samples.
+auto
+uniform_index(const double x, const double x_start, const double x_scale, const std::size_t count) -> std::size_t
+{
+  const auto i = std::ceil((x - x_start) / x_scale);
+  if (!(i > 0.0)) {
+    return 0;
+  }
+  return (i >= static_cast<double>(count)) ? count : static_cast<std::size_t>(i);
+}
+
+} // namespace
+
+auto
+line_decimator::source::operator==(const source& other) const -> bool
+{
+  return (xs == other.xs) && (ys == other.ys) && (count == other.count) && (stride == other.stride) &&
+         (version == other.version) && (x_scale == other.x_scale) && (x_start == other.x_start);
+}
+
+template<typename T>
+void
+line_decimator::plot(const char* label,
+                     const T* ys,
+                     const std::size_t count,
+                     const double x_scale,
+                     const double x_start,
+                     const ImPlotLineFlags flags,
+                     const std::uint64_t version,
+                     const int stride)
+{
+  if (!(x_scale > 0.0)) {
+    throw std::invalid_argument("The x scale of a decimated line must be positive.");
+  }
+
+  plot_impl<T>(label, nullptr, ys, count, x_scale, x_start, flags, version, stride);
+}
+
+template<typename T>
+void
+line_decimator::plot(const char* label,
+                     const T* xs,
+                     const T* ys,
+                     const std::size_t count,
+                     const ImPlotLineFlags flags,
+                     const std::uint64_t version,
+                     const int stride)
+{
+  plot_impl<T>(label, xs, ys, count, 1.0, 0.0, flags, version, stride);
+}
+
+template<typename T>
+void
+line_decimator::plot_impl(const char* label,
+                          const T* xs,
+                          const T* ys,
+                          const std::size_t count,
+                          const double x_scale,
+                          const double x_start,
+                          const ImPlotLineFlags flags,
+                          const std::uint64_t version,
+                          const int stride)
+{
+  const source src{ xs, ys, count, stride, version, x_scale, x_start };
+  if (!(src == source_)) {
+    source_ = src;
+    has_blocks_ = false;
+    has_points_ = false;
+  }
+
+  // Plots the samples in [first, last) as they are.
+  auto plot_range = [&](const std::size_t first, const std::size_t last) {
+    if ((last - first) > static_cast<std::size_t>(std::numeric_limits<int>::max())) {
+      throw std::length_error("Too many points to plot without decimation.");
+    }
+    const auto n = static_cast<int>(last - first);
+    if (xs) {
+      ImPlot::PlotLine(label, element(xs, first, stride), element(ys, first, stride), n, flags, 0, stride);
+    } else {
+      const auto start = x_start + static_cast<double>(first) * x_scale;
+      ImPlot::PlotLine(label, element(ys, first, stride), n, x_scale, start, flags, 0, stride);
+    }
+    point_count_ = last - first;
+  };
+
+  if ((flags & (ImPlotLineFlags_Segments | ImPlotLineFlags_Loop)) != 0) {
+    plot_range(0, count);
+    return;
+  }
+
+  const auto limits = ImPlot::GetPlotLimits();
+  const auto plot_pos = ImPlot::GetPlotPos();
+  const auto plot_size = ImPlot::GetPlotSize();
+  const auto width = std::max(static_cast<int>(plot_size.x), 1);
+
+  if (has_points_ && (x_min_ == limits.X.Min) && (x_max_ == limits.X.Max) && (width_ == width)) {
+    ImPlot::PlotLine(label, xs_.data(), ys_.data(), static_cast<int>(xs_.size()), flags);
+    point_count_ = xs_.size();
+    return;
+  }
+
+  auto x_at = [&](const std::size_t i) -> double {
+    return xs ? load(xs, i, stride) : (x_start + static_cast<double>(i) * x_scale);
+  };
+
+  // Gets the first sample at or after a position on the x axis, searching from a known lower bound.
+  auto lower_index = [&](const double x, const std::size_t from) -> std::size_t {
+    if (!xs) {
+      return std::max(uniform_index(x, x_start, x_scale, count), from);
+    }
+    return partition_point(from, count, [&](const std::size_t i) { return load(xs, i, stride) < x; });
+  };
+
+  auto upper_index = [&](const double x, const std::size_t from) -> std::size_t {
+    if (!xs) {
+      const auto i = std::floor((x - x_start) / x_scale) + 1.0;
+      if (!(i > 0.0)) {
+        return from;
+      }
+      return std::max((i >= static_cast<double>(count)) ? count : static_cast<std::size_t>(i), from);
+    }
+    return partition_point(from, count, [&](const std::size_t i) { return load(xs, i, stride) <= x; });
+  };
+
+  const auto first = lower_index(limits.X.Min, 0);
+  const auto last = upper_index(limits.X.Max, first);
+
+  // Include the samples just outside of the view, so that the line reaches its edges.
+  const auto range_first = (first > 0) ? (first - 1) : first;
+  const auto range_last = (last < count) ? (last + 1) : last;
+
+  has_points_ = false;
+
+  if ((range_last - range_first) <= (2 * static_cast<std::size_t>(width) + 2)) {
+    plot_range(range_first, range_last);
+    return;
+  }
+
+  if (!has_blocks_) {
+    blocks_.assign((count + block_size - 1) / block_size,
+                   block{ std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(), no_index,
+                          no_index });
+    for (std::size_t i = 0; i < count; i++) {
+      auto& b = blocks_[i / block_size];
+      const auto y = load(ys, i, stride);
+      // NaN fails both comparisons, so it never becomes an extreme.
+      if (y < b.min) {
+        b.min = y;
+        b.min_index = i;
+      }
+      if (y > b.max) {
+        b.max = y;
+        b.max_index = i;
+      }
+    }
+    has_blocks_ = true;
+  }
+
+  // Finds the extremes of [a, b), using the block summaries for the whole blocks in the range.
+  auto scan = [&](const std::size_t a, const std::size_t b) -> block {
+    block e{ std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(), no_index, no_index };
+    auto scan_samples = [&](const std::size_t from, const std::size_t to) {
+      for (auto i = from; i < to; i++) {
+        const auto y = load(ys, i, stride);
+        if (y < e.min) {
+          e.min = y;
+          e.min_index = i;
+        }
+        if (y > e.max) {
+          e.max = y;
+          e.max_index = i;
+        }
+      }
+    };
+    const auto first_block = (a + block_size - 1) / block_size;
+    const auto last_block = b / block_size;
+    if (first_block >= last_block) {
+      scan_samples(a, b);
+      return e;
+    }
+    scan_samples(a, first_block * block_size);
+    for (auto k = first_block; k < last_block; k++) {
+      const auto& s = blocks_[k];
+      if (s.min < e.min) {
+        e.min = s.min;
+        e.min_index = s.min_index;
+      }
+      if (s.max > e.max) {
+        e.max = s.max;
+        e.max_index = s.max_index;
+      }
+    }
+    scan_samples(last_block * block_size, b);
+    return e;
+  };
+
+  // The edges are found through the axis, rather than by dividing the limits, so that log and inverted axes work.
+  edges_.resize(static_cast<std::size_t>(width) + 1);
+  for (int c = 0; c <= width; c++) {
+    const auto px = plot_pos.x + plot_size.x * static_cast<float>(c) / static_cast<float>(width);
+    edges_[static_cast<std::size_t>(c)] = ImPlot::PixelsToPlot(ImVec2(px, plot_pos.y)).x;
+  }
+  if (edges_.front() > edges_.back()) {
+    std::reverse(edges_.begin(), edges_.end());
+  }
+
+  xs_.clear();
+  ys_.clear();
+
+  auto emit = [&](const std::size_t i) {
+    xs_.push_back(x_at(i));
+    ys_.push_back(load(ys, i, stride));
+  };
+
+  if (range_first < first) {
+    emit(range_first);
+  }
+
+  auto column_first = first;
+
+  for (std::size_t c = 0; c < static_cast<std::size_t>(width); c++) {
+    const auto is_last_column = (c + 1) == static_cast<std::size_t>(width);
+    const auto column_last = is_last_column ? last : std::min(lower_index(edges_[c + 1], column_first), last);
+    if (column_first == column_last) {
+      continue;
+    }
+    const auto e = scan(column_first, column_last);
+    if (e.min_index == no_index) {
+      // Only NaN in this column, which is kept so that the line shows a gap here.
+      xs_.push_back(x_at(column_first));
+      ys_.push_back(std::numeric_limits<double>::quiet_NaN());
+    } else if (e.min_index == e.max_index) {
+      emit(e.min_index);
+    } else {
+      emit(std::min(e.min_index, e.max_index));
+      emit(std::max(e.min_index, e.max_index));
+    }
+    column_first = column_last;
+  }
+
+  if (last < range_last) {
+    emit(last);
+  }
+
+  x_min_ = limits.X.Min;
+  x_max_ = limits.X.Max;
+  width_ = width;
+  has_points_ = true;
+
+  ImPlot::PlotLine(label, xs_.data(), ys_.data(), static_cast<int>(xs_.size()), flags);
+  point_count_ = xs_.size();
+}
+
+void
+line_decimator::invalidate()
+{
+  has_blocks_ = false;
+  has_points_ = false;
+}
+
+auto
+line_decimator::point_count() const -> std::size_t
+{
+  return point_count_;
+}
+
+#define GLOW_INSTANTIATE_LINE_DECIMATOR(T)                                                                             \
+  template void line_decimator::plot<T>(                                                                               \
+    const char*, const T*, std::size_t, double, double, ImPlotLineFlags, std::uint64_t, int);                          \
+  template void line_decimator::plot<T>(                                                                               \
+    const char*, const T*, const T*, std::size_t, ImPlotLineFlags, std::uint64_t, int)
+
+GLOW_INSTANTIATE_LINE_DECIMATOR(float);
+GLOW_INSTANTIATE_LINE_DECIMATOR(double);
+GLOW_INSTANTIATE_LINE_DECIMATOR(ImS8);
+GLOW_INSTANTIATE_LINE_DECIMATOR(ImU8);
+GLOW_INSTANTIATE_LINE_DECIMATOR(ImS16);
+GLOW_INSTANTIATE_LINE_DECIMATOR(ImU16);
+GLOW_INSTANTIATE_LINE_DECIMATOR(ImS32);
+GLOW_INSTANTIATE_LINE_DECIMATOR(ImU32);
+GLOW_INSTANTIATE_LINE_DECIMATOR(ImS64);
+GLOW_INSTANTIATE_LINE_DECIMATOR(ImU64);
+
+#undef GLOW_INSTANTIATE_LINE_DECIMATOR
+
+} // namespace glow
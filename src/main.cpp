@@ -11,6 +11,10 @@
 #include <implot.h>
 
 #include <glow/fonts.hpp>
+#include <glow/gl_state.hpp>
+#include <glow/plot_batch.hpp>
+#include <glow/shader_compiler.hpp>
+#include <glow/shader_warmup.hpp>
 
 #include <iostream>
 #include <string>
@@ -33,6 +37,9 @@
 
 namespace {
 
+/// @brief The time, per frame, spent on compiling the programs queued for warm-up.
+constexpr float shader_warmup_budget_ms{ 8.0f };
+
 void
 die(const char* msg)
 {
@@ -40,6 +47,20 @@ die(const char* msg)
   std::abort();
 }
 
+/// @brief Creates the window, with an OpenGL ES context of the given version.
+///
+/// @return The window, or null if the context version is not available.
+auto
+create_window(const int w, const int h, const int major_version) -> GLFWwindow*
+{
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, major_version);
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
+  glfwWindowHint(GLFW_MAXIMIZED, GLFW_TRUE);
+  glfwWindowHint(GLFW_CLIENT_API, GLFW_OPENGL_ES_API);
+
+  return glfwCreateWindow(w, h, "", nullptr, nullptr);
+}
+
 class dialog
 {
 public:
@@ -165,9 +186,41 @@ public:
 
   auto get_bold_italic_font() -> ImFont* override { return m_bold_italic_font; }
 
+  auto get_shader_warmup() -> glow::shader_warmup* override { return m_shader_warmup.get(); }
+
+  auto get_plot_batch() -> glow::plot_batch* override
+  {
+    // The batch starts worker threads, so it is only created for apps that use it.
+    if (!m_plot_batch) {
+      m_plot_batch = std::make_unique<glow::plot_batch>();
+    }
+    return m_plot_batch.get();
+  }
+
+  /// @brief Gets the plot batch if the app has asked for it, so that the loop does not create it.
+  auto used_plot_batch() -> glow::plot_batch* { return m_plot_batch.get(); }
+
+  auto warming_up() const -> bool { return m_shader_warmup && !m_shader_warmup->done(); }
+
+  void step_warmup()
+  {
+    m_shader_warmup->step(shader_warmup_budget_ms);
+    m_shader_warmup->render_progress();
+  }
+
+  /// @brief Releases the GL objects owned by the platform, while the context is still current.
+  void release_gl_resources() { m_shader_warmup.reset(); }
+
   auto get_app_name() const -> const char* { return m_app_name.c_str(); }
 
-  void set_app_name(const char* name) override { m_app_name = name; }
+  void set_app_name(const char* name) override
+  {
+    m_app_name = name;
+
+    // This is done here, instead of after setup, so that shaders compiled during setup can use the cache.
+    make_data_directory();
+    glow::set_shader_cache_directory(get_shader_cache_path());
+  }
 
   auto get_app_data_path() const -> std::string override
   {
@@ -180,12 +233,16 @@ public:
 
   auto get_documents_path() const -> std::string override { return sago::getDocumentsFolder(); }
 
+  auto get_shader_cache_path() const -> std::string { return get_app_data_path() + "/shader_cache"; }
+
   void make_data_directory()
   {
 #if defined(__linux__) || defined(__EMSCRIPTEN__)
     mkdir(get_app_data_path().c_str(), 0755);
+    mkdir(get_shader_cache_path().c_str(), 0755);
 #elif _WIN32
     CreateDirectory(get_app_data_path().c_str(), nullptr);
+    CreateDirectory(get_shader_cache_path().c_str(), nullptr);
 #endif
   }
 
@@ -250,6 +307,10 @@ private:
 
   ImFont* m_bold_italic_font{ nullptr };
 
+  std::unique_ptr<glow::shader_warmup> m_shader_warmup{ new glow::shader_warmup() };
+
+  std::unique_ptr<glow::plot_batch> m_plot_batch;
+
   std::unique_ptr<dialog> m_dialog;
 
   bool m_exit_queued{ false };
@@ -285,12 +346,18 @@ main(int argc, char** argv)
     }
   }
 
-  glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 2);
-  glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
-  glfwWindowHint(GLFW_MAXIMIZED, GLFW_TRUE);
-  glfwWindowHint(GLFW_CLIENT_API, GLFW_OPENGL_ES_API);
+  auto app = glow::app::create();
+
+  GLFWwindow* window{ nullptr };
+
+  if (app->get_context_version() == glow::context_version::es_3_0) {
+    window = create_window(w, h, 3);
+  }
+
+  if (!window) {
+    window = create_window(w, h, 2);
+  }
 
-  GLFWwindow* window = glfwCreateWindow(w, h, "", nullptr, nullptr);
   if (!window) {
     die("Failed to create a window.");
     return EXIT_FAILURE;
@@ -300,13 +367,17 @@ main(int argc, char** argv)
 
   gladLoadGLES2Loader(reinterpret_cast<GLADloadproc>(glfwGetProcAddress));
 
+  glow::install_gl_call_hooks();
+
   platform_impl plt(window);
 
+  plt.query_capabilities();
+
   glClearColor(0, 0, 0, 1);
 
   IMGUI_CHECKVERSION();
   ImGui::CreateContext();
-  ImGui_ImplOpenGL3_Init("#version 100");
+  ImGui_ImplOpenGL3_Init(plt.get_capabilities().glsl_version_directive());
   ImGui_ImplGlfw_InitForOpenGL(window, true);
   auto& io = ImGui::GetIO();
   io.ConfigFlags |= ImGuiConfigFlags_DockingEnable;
@@ -319,8 +390,6 @@ main(int argc, char** argv)
 
   plt.build_fonts();
 
-  auto app = glow::app::create();
-
   app->setup(plt);
 
   glfwSetWindowTitle(window, plt.get_app_name());
@@ -341,6 +410,15 @@ main(int argc, char** argv)
       break;
     }
 
+    const auto warming_up = plt.warming_up();
+
+    // The plot series are reduced on the worker threads while the frame is being started.
+    auto* plot_batch = warming_up ? nullptr : plt.used_plot_batch();
+
+    if (plot_batch) {
+      plot_batch->begin_frame();
+    }
+
     glfwMakeContextCurrent(window);
 
     ImGui_ImplOpenGL3_NewFrame();
@@ -357,23 +435,37 @@ main(int argc, char** argv)
     int fb_h = 0;
     glfwGetFramebufferSize(window, &fb_w, &fb_h);
 
-    glViewport(0, 0, fb_w, fb_h);
+    glow::gl_state::current().viewport(0, 0, fb_w, fb_h);
 
     glClear(GL_COLOR_BUFFER_BIT);
 
-    app->loop(plt);
+    if (warming_up) {
+      plt.step_warmup();
+    } else {
+      if (plot_batch) {
+        plot_batch->end_frame();
+      }
+      app->loop(plt);
+    }
 
     ImGui::Render();
 
     ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
 
+    // The backend changes state without going through the cache.
+    glow::gl_state::current().invalidate();
+
     glfwSwapBuffers(window);
+
+    glow::end_gl_call_stats_frame();
   }
 
   app->teardown(plt);
 
   app.reset();
 
+  plt.release_gl_resources();
+
   ImPlot::DestroyContext(plot_context);
 
   ImGui_ImplOpenGL3_Shutdown();
@@ -12,6 +12,9 @@
 #include <imgui_impl_sdl2.h>
 
 #include <glow/fonts.hpp>
+#include <glow/gl_state.hpp>
+#include <glow/plot_batch.hpp>
+#include <glow/shader_warmup.hpp>
 
 #include <iostream>
 #include <string>
@@ -24,6 +27,9 @@
 
 namespace {
 
+/// @brief The time, per frame, spent on compiling the programs queued for warm-up.
+constexpr float shader_warmup_budget_ms{ 8.0f };
+
 class platform_impl final : public glow::platform_base
 {
 public:
@@ -50,6 +56,31 @@ public:
 
   auto get_bold_italic_font() -> ImFont* override { return m_bold_italic_font; }
 
+  auto get_shader_warmup() -> glow::shader_warmup* override { return m_shader_warmup.get(); }
+
+  auto get_plot_batch() -> glow::plot_batch* override
+  {
+    // The batch starts worker threads, so it is only created for apps that use it.
+    if (!m_plot_batch) {
+      m_plot_batch = std::make_unique<glow::plot_batch>();
+    }
+    return m_plot_batch.get();
+  }
+
+  /// @brief Gets the plot batch if the app has asked for it, so that the loop does not create it.
+  auto used_plot_batch() -> glow::plot_batch* { return m_plot_batch.get(); }
+
+  auto warming_up() const -> bool { return m_shader_warmup && !m_shader_warmup->done(); }
+
+  void step_warmup()
+  {
+    m_shader_warmup->step(shader_warmup_budget_ms);
+    m_shader_warmup->render_progress();
+  }
+
+  /// @brief Releases the GL objects owned by the platform, while the context is still current.
+  void release_gl_resources() { m_shader_warmup.reset(); }
+
   auto get_app_name() const -> const char* { return m_app_name.c_str(); }
 
   void set_app_name(const char* name) override { m_app_name = name; }
@@ -84,13 +115,17 @@ private:
   ImFont* m_bold_font{ nullptr };
 
   ImFont* m_bold_italic_font{ nullptr };
+
+  std::unique_ptr<glow::shader_warmup> m_shader_warmup{ new glow::shader_warmup() };
+
+  std::unique_ptr<glow::plot_batch> m_plot_batch;
 };
 
 struct loop_data final
 {
   SDL_Window* window{ nullptr };
 
-  glow::platform* plt{ nullptr };
+  platform_impl* plt{ nullptr };
 
   glow::app* app_instance{ nullptr };
 };
@@ -105,11 +140,10 @@ main(int argc, char** argv)
     return EXIT_FAILURE;
   }
 
-  // GL ES 2.0 + GLSL 100
-  const char* glsl_version = "#version 100";
+  auto app = glow::app::create();
+
   SDL_GL_SetAttribute(SDL_GL_CONTEXT_FLAGS, 0);
   SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_ES);
-  SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 2);
   SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 0);
 
   SDL_GL_SetAttribute(SDL_GL_DOUBLEBUFFER, 1);
@@ -118,17 +152,36 @@ main(int argc, char** argv)
   SDL_WindowFlags window_flags = (SDL_WindowFlags)(SDL_WINDOW_OPENGL | SDL_WINDOW_RESIZABLE | SDL_WINDOW_ALLOW_HIGHDPI);
   SDL_Window* window = SDL_CreateWindow(
     "Dear ImGui SDL2+OpenGL3 example", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, 1280, 720, window_flags);
-  SDL_GLContext gl_context = SDL_GL_CreateContext(window);
+
+  // ES 3.0 maps to WebGL 2 and ES 2.0 to WebGL 1.
+  SDL_GLContext gl_context{ nullptr };
+  if (app->get_context_version() == glow::context_version::es_3_0) {
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 3);
+    gl_context = SDL_GL_CreateContext(window);
+  }
+
+  if (!gl_context) {
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 2);
+    gl_context = SDL_GL_CreateContext(window);
+  }
+
+  if (!gl_context) {
+    std::cerr << "Failed to create a WebGL context: " << SDL_GetError() << std::endl;
+    return EXIT_FAILURE;
+  }
+
   SDL_GL_MakeCurrent(window, gl_context);
   SDL_GL_SetSwapInterval(1); // Enable vsync
 
   platform_impl plt;
 
+  plt.query_capabilities();
+
   glClearColor(0, 0, 0, 1);
 
   IMGUI_CHECKVERSION();
   ImGui::CreateContext();
-  ImGui_ImplOpenGL3_Init("#version 100");
+  ImGui_ImplOpenGL3_Init(plt.get_capabilities().glsl_version_directive());
   ImGui_ImplSDL2_InitForOpenGL(window, gl_context);
   auto& io = ImGui::GetIO();
   io.ConfigFlags |= ImGuiConfigFlags_DockingEnable;
@@ -141,8 +194,6 @@ main(int argc, char** argv)
 
   plt.build_fonts();
 
-  auto app = glow::app::create();
-
   app->setup(plt);
 
   SDL_SetWindowTitle(window, plt.get_app_name());
@@ -156,6 +207,15 @@ main(int argc, char** argv)
 
     SDL_Window* window = l_dat->window;
 
+    const auto warming_up = l_dat->plt->warming_up();
+
+    // The plot series are reduced on the worker threads (if there are any) while the frame is being started.
+    auto* plot_batch = warming_up ? nullptr : l_dat->plt->used_plot_batch();
+
+    if (plot_batch) {
+      plot_batch->begin_frame();
+    }
+
     SDL_Event event;
     while (SDL_PollEvent(&event)) {
       ImGui_ImplSDL2_ProcessEvent(&event);
@@ -166,16 +226,28 @@ main(int argc, char** argv)
     ImGui::NewFrame();
 
     const auto& io = ImGui::GetIO();
-    glViewport(0, 0, static_cast<int>(io.DisplaySize.x), static_cast<int>(io.DisplaySize.y));
+    glow::gl_state::current().viewport(0, 0, static_cast<int>(io.DisplaySize.x), static_cast<int>(io.DisplaySize.y));
     glClear(GL_COLOR_BUFFER_BIT);
 
-    l_dat->app_instance->loop(*l_dat->plt);
+    if (warming_up) {
+      l_dat->plt->step_warmup();
+    } else {
+      if (plot_batch) {
+        plot_batch->end_frame();
+      }
+      l_dat->app_instance->loop(*l_dat->plt);
+    }
 
     ImGui::Render();
 
     ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
 
+    // The backend changes state without going through the cache.
+    glow::gl_state::current().invalidate();
+
     SDL_GL_SwapWindow(window);
+
+    glow::end_gl_call_stats_frame();
   };
 
   loop_data l_dat;
@@ -189,6 +261,8 @@ main(int argc, char** argv)
 
   app.reset();
 
+  plt.release_gl_resources();
+
   ImPlot::DestroyContext(plot_context);
 
   ImGui_ImplOpenGL3_Shutdown();
@@ -0,0 +1,116 @@
+#include "mapped_file.h"
+
+#include <stdexcept>
+
+#include <cstdint>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace glow {
+
+#ifdef _WIN32
+
+mapped_file::mapped_file(const std::string& path)
+{
+  auto file = CreateFileA(
+    path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_RANDOM_ACCESS, nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    throw std::runtime_error("Failed to open '" + path + "'.");
+  }
+
+  LARGE_INTEGER size{};
+  if (!GetFileSizeEx(file, &size) || (size.QuadPart == 0) ||
+      (static_cast<unsigned long long>(size.QuadPart) > static_cast<unsigned long long>(SIZE_MAX))) {
+    CloseHandle(file);
+    throw std::runtime_error("Cannot map '" + path + "', since it is empty or too large.");
+  }
+
+  auto mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (!mapping) {
+    CloseHandle(file);
+    throw std::runtime_error("Failed to map '" + path + "'.");
+  }
+
+  const auto* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  if (!view) {
+    CloseHandle(mapping);
+    CloseHandle(file);
+    throw std::runtime_error("Failed to map '" + path + "'.");
+  }
+
+  data_ = static_cast<const unsigned char*>(view);
+  size_ = static_cast<std::size_t>(size.QuadPart);
+  file_ = file;
+  mapping_ = mapping;
+}
+
+mapped_file::~mapped_file()
+{
+  UnmapViewOfFile(data_);
+  CloseHandle(mapping_);
+  CloseHandle(file_);
+}
+
+#else
+
+mapped_file::mapped_file(const std::string& path)
+{
+  const auto fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::runtime_error("Failed to open '" + path + "'.");
+  }
+
+  struct stat info
+  {};
+
+  if ((fstat(fd, &info) != 0) || (info.st_size <= 0) ||
+      (static_cast<unsigned long long>(info.st_size) > static_cast<unsigned long long>(SIZE_MAX))) {
+    close(fd);
+    throw std::runtime_error("Cannot map '" + path + "', since it is empty or too large.");
+  }
+
+  const auto size = static_cast<std::size_t>(info.st_size);
+
+  auto* view = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+
+  // The mapping keeps its own reference to the file.
+  close(fd);
+
+  if (view == MAP_FAILED) {
+    throw std::runtime_error("Failed to map '" + path + "'.");
+  }
+
+  // Plots jump around the file as the view changes, so read-ahead would mostly load pages that are never used.
+  madvise(view, size, MADV_RANDOM);
+
+  data_ = static_cast<const unsigned char*>(view);
+  size_ = size;
+}
+
+mapped_file::~mapped_file()
+{
+  munmap(const_cast<unsigned char*>(data_), size_);
+}
+
+#endif
+
+auto
+mapped_file::data() const -> const unsigned char*
+{
+  return data_;
+}
+
+auto
+mapped_file::size() const -> std::size_t
+{
+  return size_;
+}
+
+} // namespace glow
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <string>
+
+#include <cstddef>
+
+namespace glow {
+
+/// @brief Maps a whole file into memory for reading, so that its pages are only read from disk once they are touched.
+///
+/// @note The file must fit in the address space, which limits it to a few GB on 32-bit platforms.
+class mapped_file final
+{
+public:
+  /// @brief Maps a file.
+  ///
+  /// @note Throws @c std::runtime_error if the file cannot be opened or mapped, or if it is empty.
+  explicit mapped_file(const std::string& path);
+
+  mapped_file(const mapped_file&) = delete;
+
+  mapped_file(mapped_file&&) = delete;
+
+  auto operator=(const mapped_file&) -> mapped_file& = delete;
+
+  auto operator=(mapped_file&&) -> mapped_file& = delete;
+
+  ~mapped_file();
+
+  [[nodiscard]] auto data() const -> const unsigned char*;
+
+  [[nodiscard]] auto size() const -> std::size_t;
+
+private:
+  const unsigned char* data_{ nullptr };
+
+  std::size_t size_{};
+
+#ifdef _WIN32
+  void* file_{ nullptr };
+
+  void* mapping_{ nullptr };
+#endif
+};
+
+} // namespace glow
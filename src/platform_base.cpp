@@ -25,4 +25,22 @@ platform_base::~platform_base()
   delete m_impl;
 }
 
+auto
+platform_base::get_capabilities() const -> const gl_capabilities&
+{
+  return m_capabilities;
+}
+
+auto
+platform_base::get_gl_call_stats() const -> gl_call_stats
+{
+  return glow::get_gl_call_stats();
+}
+
+void
+platform_base::query_capabilities()
+{
+  m_capabilities = query_gl_capabilities();
+}
+
 } // namespace glow
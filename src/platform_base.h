@@ -21,7 +21,16 @@ public:
 
   ~platform_base() override;
 
+  auto get_capabilities() const -> const gl_capabilities& override;
+
+  auto get_gl_call_stats() const -> gl_call_stats override;
+
+  /// @brief Queries the capabilities of the context, once it has been created and made current.
+  void query_capabilities();
+
 private:
+  gl_capabilities m_capabilities;
+
   impl* m_impl{ nullptr };
 };
 
@@ -0,0 +1,468 @@
+#include <glow/plot_batch.hpp>
+
+#include <glow/reduce.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#include <cmath>
+
+namespace glow {
+
+namespace {
+
+constexpr auto nan = std::numeric_limits<double>::quiet_NaN();
+
+/// @brief The number of pixel columns to reduce a series to before it is first plotted, when its view is not known.
+constexpr int default_width{ 1024 };
+
+/// @brief How much of the view is added on each side of it when reducing, so that panning does not uncover the edges.
+constexpr double view_margin{ 0.5 };
+
+/// @brief The number of frames a series can go without being plotted in a plot before its view of that plot is dropped.
+constexpr std::uint64_t view_lifetime{ 120 };
+
+/// @brief Clamps a sample position to an index in [0, count].
+auto
+clamp_index(const double position, const std::size_t count) -> std::size_t
+{
+  if (!(position > 0.0)) {
+    return 0;
+  }
+
+  return (position < static_cast<double>(count)) ? static_cast<std::size_t>(position) : count;
+}
+
+template<typename T>
+void
+reduce_values(const T* values,
+              const std::size_t count,
+              const double x_scale,
+              const double x_start,
+              const double view_min,
+              const double view_max,
+              const int view_width,
+              const bool stats_enabled,
+              std::vector<double>& xs,
+              std::vector<double>& ys,
+              std::vector<double>& starts,
+              std::vector<double>& mins,
+              std::vector<double>& maxs,
+              series_stats& stats)
+{
+  xs.clear();
+  ys.clear();
+  starts.clear();
+  mins.clear();
+  maxs.clear();
+
+  stats = series_stats{ nan, nan, nan, 0 };
+
+  if (count == 0) {
+    return;
+  }
+
+  auto x_at = [&](const std::size_t i) { return x_start + static_cast<double>(i) * x_scale; };
+
+  const auto span = view_max - view_min;
+
+  const auto first = clamp_index(std::floor((view_min - span * view_margin - x_start) / x_scale), count);
+  const auto last = clamp_index(std::ceil((view_max + span * view_margin - x_start) / x_scale) + 1.0, count);
+
+  if (stats_enabled) {
+    const auto view_first = clamp_index(std::ceil((view_min - x_start) / x_scale), count);
+    const auto view_last = std::max(clamp_index(std::floor((view_max - x_start) / x_scale) + 1.0, count), view_first);
+    const auto n = view_last - view_first;
+    const auto r = reduce_min_max(values + view_first, n);
+    const auto is_empty = r.min > r.max;
+    stats = series_stats{ is_empty ? nan : r.min, is_empty ? nan : r.max, reduce_mean(values + view_first, n), n };
+  }
+
+  if (first >= last) {
+    return;
+  }
+
+  // The runs are aligned to multiples of their size, rather than to the view, so that they stay the same while panning
+  // and the line does not shimmer.
+  const auto samples_per_pixel = span / x_scale / static_cast<double>(std::max(view_width, 1));
+
+  const auto run = (samples_per_pixel > 1.0) ? static_cast<std::size_t>(samples_per_pixel) : std::size_t{ 1 };
+
+  if (run <= 2) {
+    for (auto i = first; i < last; i++) {
+      const auto x = x_at(i);
+      const auto y = static_cast<double>(values[i]);
+      xs.push_back(x);
+      ys.push_back(y);
+      starts.push_back(x);
+      mins.push_back(y);
+      maxs.push_back(y);
+    }
+    return;
+  }
+
+  for (auto i = (first / run) * run; i < last; i += run) {
+
+    const auto end = std::min(i + run, count);
+
+    const auto r = reduce_min_max(values + i, end - i);
+
+    const auto is_gap = r.min > r.max;
+
+    const auto min = is_gap ? nan : r.min;
+    const auto max = is_gap ? nan : r.max;
+
+    starts.push_back(x_at(i));
+    mins.push_back(min);
+    maxs.push_back(max);
+
+    xs.push_back(x_at(i));
+    ys.push_back(min);
+    if (max != min) {
+      xs.push_back(x_at(end - 1));
+      ys.push_back(max);
+    }
+  }
+}
+
+} // namespace
+
+plot_batch::plot_batch(const std::size_t threads)
+  : pool_(threads)
+{
+}
+
+plot_batch::~plot_batch()
+{
+  // The tasks of a running batch point into the series, so they must finish first.
+  try {
+    end_frame();
+  } catch (...) {
+  }
+}
+
+template<typename T>
+auto
+plot_batch::add_series(const T* values, const std::size_t count, const double x_scale, const double x_start)
+  -> std::size_t
+{
+  if constexpr (std::is_same_v<T, float>) {
+    return add(values, value_type::float32, count, x_scale, x_start);
+  } else if constexpr (std::is_same_v<T, double>) {
+    return add(values, value_type::float64, count, x_scale, x_start);
+  } else {
+    return add(values, value_type::int16, count, x_scale, x_start);
+  }
+}
+
+template<typename T>
+void
+plot_batch::set_series_data(const std::size_t id,
+                            const T* values,
+                            const std::size_t count,
+                            const double x_scale,
+                            const double x_start)
+{
+  if constexpr (std::is_same_v<T, float>) {
+    set(id, values, value_type::float32, count, x_scale, x_start);
+  } else if constexpr (std::is_same_v<T, double>) {
+    set(id, values, value_type::float64, count, x_scale, x_start);
+  } else {
+    set(id, values, value_type::int16, count, x_scale, x_start);
+  }
+}
+
+#define GLOW_PLOT_BATCH_INSTANTIATE(T)                                                                                 \
+  template auto plot_batch::add_series<T>(const T*, std::size_t, double, double)->std::size_t;                         \
+  template void plot_batch::set_series_data<T>(std::size_t, const T*, std::size_t, double, double);
+
+GLOW_PLOT_BATCH_INSTANTIATE(float)
+GLOW_PLOT_BATCH_INSTANTIATE(double)
+GLOW_PLOT_BATCH_INSTANTIATE(std::int16_t)
+
+#undef GLOW_PLOT_BATCH_INSTANTIATE
+
+auto
+plot_batch::add(const void* values,
+                const value_type type,
+                const std::size_t count,
+                const double x_scale,
+                const double x_start) -> std::size_t
+{
+  end_frame();
+
+  auto slot = std::find(series_.begin(), series_.end(), nullptr);
+  if (slot == series_.end()) {
+    slot = series_.emplace(series_.end());
+  }
+
+  slot->reset(new series());
+
+  const auto id = static_cast<std::size_t>(slot - series_.begin());
+
+  try {
+    set(id, values, type, count, x_scale, x_start);
+  } catch (...) {
+    slot->reset();
+    throw;
+  }
+
+  return id;
+}
+
+void
+plot_batch::set(const std::size_t id,
+                const void* values,
+                const value_type type,
+                const std::size_t count,
+                const double x_scale,
+                const double x_start)
+{
+  if (!(x_scale > 0.0)) {
+    throw std::invalid_argument("The x scale of a plot series must be positive.");
+  }
+
+  if (!values && (count > 0)) {
+    throw std::invalid_argument("A plot series with samples needs an array to read them from.");
+  }
+
+  end_frame();
+
+  auto& s = get_series(id);
+  s.values = values;
+  s.type = type;
+  s.count = count;
+  s.x_scale = x_scale;
+  s.x_start = x_start;
+}
+
+void
+plot_batch::set_stats_enabled(const std::size_t id, const bool enabled)
+{
+  end_frame();
+
+  get_series(id).stats_enabled = enabled;
+}
+
+void
+plot_batch::remove_series(const std::size_t id)
+{
+  end_frame();
+
+  if ((id >= series_.size()) || !series_[id]) {
+    throw std::out_of_range("Plot series identifier is out of range.");
+  }
+
+  series_[id].reset();
+
+  while (!series_.empty() && !series_.back()) {
+    series_.pop_back();
+  }
+}
+
+void
+plot_batch::clear()
+{
+  end_frame();
+
+  series_.clear();
+}
+
+void
+plot_batch::begin_frame()
+{
+  end_frame();
+
+  frame_++;
+
+  pending_.clear();
+
+  // Only the views that were plotted in the last frame are likely to be plotted again, and the ones that were never
+  // reduced are done in case they are about to be plotted for the first time.
+  for (auto& s : series_) {
+
+    if (!s) {
+      continue;
+    }
+
+    auto& views = s->views;
+
+    views.erase(std::remove_if(views.begin(),
+                               views.end(),
+                               [this](const view& v) {
+                                 return (v.plot_id != 0) && ((frame_ - v.plotted_frame) > view_lifetime);
+                               }),
+                views.end());
+
+    // Until a series is plotted, it is reduced once over all of its samples, so that its first plot has a line to show.
+    if (views.empty()) {
+      views.emplace_back();
+    }
+
+    for (auto& v : views) {
+      if ((v.reduced_frame == 0) || (v.plotted_frame + 1 == frame_)) {
+        v.reduced_frame = frame_;
+        pending_.push_back(task{ s.get(), &v });
+      }
+    }
+  }
+
+  if (pending_.empty()) {
+    return;
+  }
+
+  reducing_ = true;
+
+  pool_.start(pending_.size(), [this](const std::size_t i) { reduce(*pending_[i].s, *pending_[i].v); });
+}
+
+void
+plot_batch::end_frame()
+{
+  if (!reducing_) {
+    return;
+  }
+
+  reducing_ = false;
+
+  pool_.wait();
+}
+
+void
+plot_batch::plot_line(const char* label, const std::size_t id, const ImPlotLineFlags flags)
+{
+  const auto& v = prepare(id);
+
+  ImPlot::PlotLine(label, v.xs.data(), v.ys.data(), static_cast<int>(v.xs.size()), flags);
+}
+
+void
+plot_batch::plot_envelope(const char* label, const std::size_t id, const ImPlotShadedFlags flags)
+{
+  const auto& v = prepare(id);
+
+  ImPlot::PlotShaded(label, v.starts.data(), v.mins.data(), v.maxs.data(), static_cast<int>(v.starts.size()), flags);
+}
+
+auto
+plot_batch::stats(const std::size_t id) const -> series_stats
+{
+  const auto& s = get_series(id);
+
+  for (const auto& v : s.views) {
+    if (v.plot_id == s.last_plot_id) {
+      return v.stats;
+    }
+  }
+
+  return series_stats{ nan, nan, nan, 0 };
+}
+
+auto
+plot_batch::series_count() const -> std::size_t
+{
+  return static_cast<std::size_t>(std::count_if(series_.begin(), series_.end(), [](const auto& s) { return !!s; }));
+}
+
+auto
+plot_batch::get_task_pool() -> task_pool&
+{
+  return pool_;
+}
+
+auto
+plot_batch::get_series(const std::size_t id) const -> series&
+{
+  if ((id >= series_.size()) || !series_[id]) {
+    throw std::out_of_range("Plot series identifier is out of range.");
+  }
+
+  return *series_[id];
+}
+
+auto
+plot_batch::prepare(const std::size_t id) -> view&
+{
+  end_frame();
+
+  auto& s = get_series(id);
+
+  // ImPlot pushes the ID of the plot between BeginPlot and EndPlot, so this identifies the current plot.
+  const auto plot_id = ImGui::GetID("##plot_batch");
+
+  auto it = std::find_if(s.views.begin(), s.views.end(), [plot_id](const view& v) { return v.plot_id == plot_id; });
+
+  if (it == s.views.end()) {
+    // The first plot to show the series takes over the reduction that was made before the view was known.
+    it = std::find_if(s.views.begin(), s.views.end(), [](const view& v) { return v.plot_id == 0; });
+    if (it == s.views.end()) {
+      it = s.views.emplace(s.views.end());
+    }
+    it->plot_id = plot_id;
+  }
+
+  auto& v = *it;
+
+  const auto limits = ImPlot::GetPlotLimits();
+
+  v.min = limits.X.Min;
+  v.max = limits.X.Max;
+  v.width = static_cast<int>(ImPlot::GetPlotSize().x);
+  v.plotted_frame = frame_;
+
+  s.last_plot_id = plot_id;
+
+  if (v.reduced_frame != frame_) {
+    v.reduced_frame = frame_;
+    reduce(s, v);
+  }
+
+  return v;
+}
+
+void
+plot_batch::reduce(const series& s, view& v)
+{
+  auto view_min = v.min;
+  auto view_max = v.max;
+  auto view_width = v.width;
+
+  if (v.plot_id == 0) {
+    view_min = s.x_start;
+    view_max = s.x_start + static_cast<double>((s.count > 0) ? (s.count - 1) : 0) * s.x_scale;
+    view_width = default_width;
+  }
+
+  auto reduce_as = [&](const auto* values) {
+    reduce_values(values,
+                  s.count,
+                  s.x_scale,
+                  s.x_start,
+                  view_min,
+                  view_max,
+                  view_width,
+                  s.stats_enabled,
+                  v.xs,
+                  v.ys,
+                  v.starts,
+                  v.mins,
+                  v.maxs,
+                  v.stats);
+  };
+
+  switch (s.type) {
+    case value_type::float32:
+      reduce_as(static_cast<const float*>(s.values));
+      break;
+    case value_type::float64:
+      reduce_as(static_cast<const double*>(s.values));
+      break;
+    case value_type::int16:
+      reduce_as(static_cast<const std::int16_t*>(s.values));
+      break;
+  }
+}
+
+} // namespace glow
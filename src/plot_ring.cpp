@@ -0,0 +1,169 @@
+#include <glow/plot_ring.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+#include <cstring>
+
+namespace glow {
+
+plot_ring::plot_ring(const std::size_t capacity, const std::size_t channels, const bool has_time)
+  : capacity_(capacity)
+  , channels_(channels)
+  , columns_(channels + (has_time ? 1 : 0))
+  , has_time_(has_time)
+{
+  if ((capacity == 0) || (channels == 0)) {
+    throw std::invalid_argument("A plot ring needs at least one row and one channel.");
+  }
+
+  if (capacity > static_cast<std::size_t>(std::numeric_limits<int>::max())) {
+    throw std::invalid_argument("A plot ring cannot hold more rows than ImPlot can index.");
+  }
+
+  data_.resize(capacity_ * columns_);
+}
+
+void
+plot_ring::append(const double* rows, std::size_t row_count)
+{
+  total_ += row_count;
+
+  // Only the newest rows that fit are kept.
+  if (row_count > capacity_) {
+    rows += (row_count - capacity_) * columns_;
+    row_count = capacity_;
+  }
+
+  const auto first = std::min(row_count, capacity_ - head_);
+
+  std::memcpy(data_.data() + head_ * columns_, rows, first * columns_ * sizeof(double));
+
+  if (first < row_count) {
+    std::memcpy(data_.data(), rows + first * columns_, (row_count - first) * columns_ * sizeof(double));
+  }
+
+  head_ = (head_ + row_count) % capacity_;
+
+  size_ = std::min(size_ + row_count, capacity_);
+}
+
+void
+plot_ring::clear()
+{
+  head_ = 0;
+  size_ = 0;
+  total_ = 0;
+}
+
+void
+plot_ring::plot_line(const char* label,
+                     const std::size_t channel,
+                     const ImPlotLineFlags flags,
+                     const double x_scale) const
+{
+  const auto* ys = value_column(channel);
+  const auto count = static_cast<int>(size_);
+  const auto stride = static_cast<int>(columns_ * sizeof(double));
+
+  if (has_time_) {
+    ImPlot::PlotLine(label, column(0), ys, count, flags, offset(), stride);
+  } else {
+    ImPlot::PlotLine(label, ys, count, x_scale, x_range(x_scale).first, flags, offset(), stride);
+  }
+}
+
+void
+plot_ring::plot_scatter(const char* label,
+                        const std::size_t channel,
+                        const ImPlotScatterFlags flags,
+                        const double x_scale) const
+{
+  const auto* ys = value_column(channel);
+  const auto count = static_cast<int>(size_);
+  const auto stride = static_cast<int>(columns_ * sizeof(double));
+
+  if (has_time_) {
+    ImPlot::PlotScatter(label, column(0), ys, count, flags, offset(), stride);
+  } else {
+    ImPlot::PlotScatter(label, ys, count, x_scale, x_range(x_scale).first, flags, offset(), stride);
+  }
+}
+
+auto
+plot_ring::x_range(const double x_scale) const -> std::pair<double, double>
+{
+  if (size_ == 0) {
+    return { 0.0, 0.0 };
+  }
+
+  if (has_time_) {
+    const auto oldest = (head_ + capacity_ - size_) % capacity_;
+    const auto newest = (head_ + capacity_ - 1) % capacity_;
+    return { data_[oldest * columns_], data_[newest * columns_] };
+  }
+
+  return { static_cast<double>(total_ - size_) * x_scale, static_cast<double>(total_ - 1) * x_scale };
+}
+
+auto
+plot_ring::size() const -> std::size_t
+{
+  return size_;
+}
+
+auto
+plot_ring::capacity() const -> std::size_t
+{
+  return capacity_;
+}
+
+auto
+plot_ring::channels() const -> std::size_t
+{
+  return channels_;
+}
+
+auto
+plot_ring::columns() const -> std::size_t
+{
+  return columns_;
+}
+
+auto
+plot_ring::has_time() const -> bool
+{
+  return has_time_;
+}
+
+auto
+plot_ring::total_count() const -> std::size_t
+{
+  return total_;
+}
+
+auto
+plot_ring::offset() const -> int
+{
+  // Until the ring wraps, the oldest row is the first one. After that, it is the one about to be overwritten.
+  return (size_ < capacity_) ? 0 : static_cast<int>(head_);
+}
+
+auto
+plot_ring::column(const std::size_t index) const -> const double*
+{
+  return data_.data() + index;
+}
+
+auto
+plot_ring::value_column(const std::size_t channel) const -> const double*
+{
+  if (channel >= channels_) {
+    throw std::out_of_range("Plot ring channel index is out of range.");
+  }
+
+  return column(channel + (has_time_ ? 1 : 0));
+}
+
+} // namespace glow
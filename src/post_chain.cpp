@@ -0,0 +1,152 @@
+#include <glow/post_chain.hpp>
+
+#include <glow/gl_state.hpp>
+#include <glow/shader_compiler.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace glow {
+
+namespace {
+
+auto
+scaled_size(const GLsizei size, const float scale) -> GLsizei
+{
+  return std::max(static_cast<GLsizei>(std::lround(static_cast<float>(size) * scale)), static_cast<GLsizei>(1));
+}
+
+} // namespace
+
+post_chain::post_chain(framebuffer_pool& pool)
+  : pool_(&pool)
+{
+  format_.min_filter = GL_LINEAR;
+  format_.mag_filter = GL_LINEAR;
+}
+
+post_chain::~post_chain()
+{
+  for (auto& p : passes_) {
+    gl_state::current().forget_program(p.program);
+    glDeleteProgram(p.program);
+  }
+}
+
+auto
+post_chain::add_pass(const char* frag_source,
+                     const float resolution_scale,
+                     const defines& defs,
+                     uniform_callback callback) -> std::size_t
+{
+  pass p;
+  p.program = compile_shader(screen_quad::fullscreen_vertex_shader, frag_source, defs, shader_version::es_300);
+  p.input_texture_location = glGetUniformLocation(p.program, "input_texture");
+  p.input_texel_size_location = glGetUniformLocation(p.program, "input_texel_size");
+  p.source_texture_location = glGetUniformLocation(p.program, "source_texture");
+  p.resolution_scale = resolution_scale;
+  p.callback = std::move(callback);
+  passes_.emplace_back(std::move(p));
+  return passes_.size() - 1;
+}
+
+void
+post_chain::set_resolution_scale(const std::size_t pass_index, const float resolution_scale)
+{
+  passes_.at(pass_index).resolution_scale = resolution_scale;
+}
+
+void
+post_chain::set_enabled(const std::size_t pass_index, const bool enabled)
+{
+  passes_.at(pass_index).enabled = enabled;
+}
+
+void
+post_chain::set_uniform_callback(const std::size_t pass_index, uniform_callback callback)
+{
+  passes_.at(pass_index).callback = std::move(callback);
+}
+
+void
+post_chain::set_format(const framebuffer_format& format)
+{
+  format_ = format;
+}
+
+auto
+post_chain::program(const std::size_t pass_index) const -> GLuint
+{
+  return passes_.at(pass_index).program;
+}
+
+auto
+post_chain::pass_count() const -> std::size_t
+{
+  return passes_.size();
+}
+
+auto
+post_chain::run(const GLuint input_texture, const GLsizei width, const GLsizei height) -> framebuffer*
+{
+  framebuffer* previous{ nullptr };
+
+  GLuint input = input_texture;
+  GLsizei input_w = width;
+  GLsizei input_h = height;
+
+  auto& state = gl_state::current();
+
+  state.disable(GL_BLEND);
+  state.disable(GL_DEPTH_TEST);
+  state.disable(GL_SCISSOR_TEST);
+
+  for (auto& p : passes_) {
+
+    if (!p.enabled) {
+      continue;
+    }
+
+    const auto target_w = scaled_size(width, p.resolution_scale);
+    const auto target_h = scaled_size(height, p.resolution_scale);
+
+    auto& target = pool_->acquire(target_w, target_h, format_);
+
+    target.bind();
+
+    state.viewport(0, 0, target.width(), target.height());
+
+    state.use_program(p.program);
+
+    state.bind_texture(0, GL_TEXTURE_2D, input);
+    glUniform1i(p.input_texture_location, 0);
+    glUniform2f(p.input_texel_size_location, 1.0f / static_cast<float>(input_w), 1.0f / static_cast<float>(input_h));
+
+    if (p.source_texture_location >= 0) {
+      state.bind_texture(1, GL_TEXTURE_2D, input_texture);
+      glUniform1i(p.source_texture_location, 1);
+      state.active_texture(0);
+    }
+
+    if (p.callback) {
+      p.callback(p.program);
+    }
+
+    quad_.draw_triangle();
+
+    if (previous) {
+      pool_->release(*previous);
+    }
+
+    previous = &target;
+    input = target.color_attachment();
+    input_w = target.width();
+    input_h = target.height();
+  }
+
+  state.bind_framebuffer(GL_FRAMEBUFFER, 0);
+
+  return previous;
+}
+
+} // namespace glow
@@ -0,0 +1,624 @@
+#include <glow/program.hpp>
+
+#include <glow/gl_state.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace glow {
+
+namespace {
+
+auto
+hash_name(const char* name) -> std::uint32_t
+{
+  std::uint32_t h{ 2166136261u };
+
+  for (const char* c = name; *c; c++) {
+    h = (h ^ static_cast<unsigned char>(*c)) * 16777619u;
+  }
+
+  return h;
+}
+
+/// @brief Gets the size of a uniform type, in bytes.
+auto
+type_size(const GLenum type) -> std::size_t
+{
+  switch (type) {
+    case GL_FLOAT_VEC2:
+    case GL_INT_VEC2:
+    case GL_UNSIGNED_INT_VEC2:
+    case GL_BOOL_VEC2:
+      return 8;
+    case GL_FLOAT_VEC3:
+    case GL_INT_VEC3:
+    case GL_UNSIGNED_INT_VEC3:
+    case GL_BOOL_VEC3:
+      return 12;
+    case GL_FLOAT_VEC4:
+    case GL_INT_VEC4:
+    case GL_UNSIGNED_INT_VEC4:
+    case GL_BOOL_VEC4:
+    case GL_FLOAT_MAT2:
+      return 16;
+    case GL_FLOAT_MAT2x3:
+    case GL_FLOAT_MAT3x2:
+      return 24;
+    case GL_FLOAT_MAT2x4:
+    case GL_FLOAT_MAT4x2:
+      return 32;
+    case GL_FLOAT_MAT3:
+      return 36;
+    case GL_FLOAT_MAT3x4:
+    case GL_FLOAT_MAT4x3:
+      return 48;
+    case GL_FLOAT_MAT4:
+      return 64;
+    default:
+      return 4;
+  }
+}
+
+/// @brief Whether a uniform type is set with the floating point variants of @c glUniform.
+auto
+is_float_type(const GLenum type) -> bool
+{
+  switch (type) {
+    case GL_FLOAT:
+    case GL_FLOAT_VEC2:
+    case GL_FLOAT_VEC3:
+    case GL_FLOAT_VEC4:
+    case GL_FLOAT_MAT2:
+    case GL_FLOAT_MAT3:
+    case GL_FLOAT_MAT4:
+    case GL_FLOAT_MAT2x3:
+    case GL_FLOAT_MAT2x4:
+    case GL_FLOAT_MAT3x2:
+    case GL_FLOAT_MAT3x4:
+    case GL_FLOAT_MAT4x2:
+    case GL_FLOAT_MAT4x3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+/// @brief Whether a uniform type is set with the unsigned variants of @c glUniform.
+auto
+is_unsigned_type(const GLenum type) -> bool
+{
+  return (type == GL_UNSIGNED_INT) || (type == GL_UNSIGNED_INT_VEC2) || (type == GL_UNSIGNED_INT_VEC3) ||
+         (type == GL_UNSIGNED_INT_VEC4);
+}
+
+/// @brief Gets the number of components of an integer, boolean or sampler uniform type.
+auto
+integer_components(const GLenum type) -> int
+{
+  switch (type) {
+    case GL_INT_VEC2:
+    case GL_UNSIGNED_INT_VEC2:
+    case GL_BOOL_VEC2:
+      return 2;
+    case GL_INT_VEC3:
+    case GL_UNSIGNED_INT_VEC3:
+    case GL_BOOL_VEC3:
+      return 3;
+    case GL_INT_VEC4:
+    case GL_UNSIGNED_INT_VEC4:
+    case GL_BOOL_VEC4:
+      return 4;
+    default:
+      return 1;
+  }
+}
+
+auto
+strip_array_suffix(const std::string& name) -> std::string
+{
+  const auto pos = name.rfind("[0]");
+  if ((pos != std::string::npos) && (pos + 3 == name.size())) {
+    return name.substr(0, pos);
+  }
+  return name;
+}
+
+} // namespace
+
+program::program(const GLuint id)
+  : id_(id)
+{
+  GLint max_name_length{ 0 };
+  GLint count{ 0 };
+
+  glGetProgramiv(id_, GL_ACTIVE_UNIFORM_MAX_LENGTH, &max_name_length);
+  glGetProgramiv(id_, GL_ACTIVE_UNIFORMS, &count);
+
+  std::vector<char> name_buffer(static_cast<std::size_t>(std::max(max_name_length, 1)));
+
+  std::size_t shadow_size{ 0 };
+
+  for (GLint i = 0; i < count; i++) {
+
+    GLsizei length{ 0 };
+
+    variable v;
+
+    glGetActiveUniform(
+      id_, static_cast<GLuint>(i), max_name_length, &length, &v.array_size, &v.type, name_buffer.data());
+
+    v.name.assign(name_buffer.data(), static_cast<std::size_t>(length));
+
+    v.location = glGetUniformLocation(id_, v.name.c_str());
+
+    // Uniforms in uniform blocks have no location and are not set with glUniform.
+    if (v.location < 0) {
+      continue;
+    }
+
+    v.shadow_offset = shadow_size;
+
+    shadow_size += type_size(v.type) * static_cast<std::size_t>(v.array_size);
+
+    uniforms_.emplace_back(std::move(v));
+  }
+
+  // After linking, all uniforms in the default block are zero, so the shadow copy starts out in sync.
+  shadow_.resize(shadow_size, 0);
+
+  glGetProgramiv(id_, GL_ACTIVE_ATTRIBUTE_MAX_LENGTH, &max_name_length);
+  glGetProgramiv(id_, GL_ACTIVE_ATTRIBUTES, &count);
+
+  name_buffer.resize(static_cast<std::size_t>(std::max(max_name_length, 1)));
+
+  for (GLint i = 0; i < count; i++) {
+
+    GLsizei length{ 0 };
+
+    variable v;
+
+    glGetActiveAttrib(
+      id_, static_cast<GLuint>(i), max_name_length, &length, &v.array_size, &v.type, name_buffer.data());
+
+    v.name.assign(name_buffer.data(), static_cast<std::size_t>(length));
+
+    v.location = glGetAttribLocation(id_, v.name.c_str());
+
+    attributes_.emplace_back(std::move(v));
+  }
+
+  uniform_table_.build(uniforms_);
+
+  attribute_table_.build(attributes_);
+}
+
+program::~program()
+{
+  gl_state::current().forget_program(id_);
+
+  glDeleteProgram(id_);
+}
+
+auto
+program::id() const -> GLuint
+{
+  return id_;
+}
+
+void
+program::use()
+{
+  gl_state::current().use_program(id_);
+}
+
+auto
+program::find_uniform(const char* name) const -> uniform_handle
+{
+  return uniform_handle{ uniform_table_.find(uniforms_, name) };
+}
+
+auto
+program::uniform_location(const char* name) const -> GLint
+{
+  const auto index = uniform_table_.find(uniforms_, name);
+
+  return (index < 0) ? -1 : uniforms_[static_cast<std::size_t>(index)].location;
+}
+
+auto
+program::attrib_location(const char* name) const -> GLint
+{
+  const auto index = attribute_table_.find(attributes_, name);
+
+  return (index < 0) ? -1 : attributes_[static_cast<std::size_t>(index)].location;
+}
+
+auto
+program::update_shadow(const uniform_handle u, const void* data, const std::size_t size) -> bool
+{
+  if (!u.valid()) {
+    return false;
+  }
+
+  const auto& v = uniforms_[static_cast<std::size_t>(u.index)];
+
+  auto* shadow = shadow_.data() + v.shadow_offset;
+
+  const auto shadow_size = std::min(size, type_size(v.type) * static_cast<std::size_t>(v.array_size));
+
+  if (std::memcmp(shadow, data, shadow_size) == 0) {
+    skip_count_++;
+    return false;
+  }
+
+  std::memcpy(shadow, data, shadow_size);
+
+  upload_count_++;
+
+  return true;
+}
+
+void
+program::set(const uniform_handle u, const float x)
+{
+  if (update_shadow(u, &x, sizeof(x))) {
+    glUniform1f(uniforms_[static_cast<std::size_t>(u.index)].location, x);
+  }
+}
+
+void
+program::set(const uniform_handle u, const float x, const float y)
+{
+  const float v[]{ x, y };
+
+  if (update_shadow(u, v, sizeof(v))) {
+    glUniform2fv(uniforms_[static_cast<std::size_t>(u.index)].location, 1, v);
+  }
+}
+
+void
+program::set(const uniform_handle u, const float x, const float y, const float z)
+{
+  const float v[]{ x, y, z };
+
+  if (update_shadow(u, v, sizeof(v))) {
+    glUniform3fv(uniforms_[static_cast<std::size_t>(u.index)].location, 1, v);
+  }
+}
+
+void
+program::set(const uniform_handle u, const float x, const float y, const float z, const float w)
+{
+  const float v[]{ x, y, z, w };
+
+  if (update_shadow(u, v, sizeof(v))) {
+    glUniform4fv(uniforms_[static_cast<std::size_t>(u.index)].location, 1, v);
+  }
+}
+
+void
+program::set(const uniform_handle u, const int x)
+{
+  set_integers(u, &x, 1, 1);
+}
+
+void
+program::set(const uniform_handle u, const int x, const int y)
+{
+  const GLint v[]{ x, y };
+
+  set_integers(u, v, 2, 1);
+}
+
+void
+program::set(const uniform_handle u, const int x, const int y, const int z)
+{
+  const GLint v[]{ x, y, z };
+
+  set_integers(u, v, 3, 1);
+}
+
+void
+program::set(const uniform_handle u, const int x, const int y, const int z, const int w)
+{
+  const GLint v[]{ x, y, z, w };
+
+  set_integers(u, v, 4, 1);
+}
+
+void
+program::set(const uniform_handle u, const unsigned int x)
+{
+  const GLuint v[]{ x };
+
+  set_integers(u, v, 1, 1);
+}
+
+void
+program::set(const uniform_handle u, const unsigned int x, const unsigned int y)
+{
+  const GLuint v[]{ x, y };
+
+  set_integers(u, v, 2, 1);
+}
+
+void
+program::set(const uniform_handle u, const unsigned int x, const unsigned int y, const unsigned int z)
+{
+  const GLuint v[]{ x, y, z };
+
+  set_integers(u, v, 3, 1);
+}
+
+void
+program::set(const uniform_handle u,
+             const unsigned int x,
+             const unsigned int y,
+             const unsigned int z,
+             const unsigned int w)
+{
+  const GLuint v[]{ x, y, z, w };
+
+  set_integers(u, v, 4, 1);
+}
+
+void
+program::set_integers(const uniform_handle u, const void* values, const int components, const std::size_t count)
+{
+  if (!update_shadow(u, values, sizeof(GLint) * static_cast<std::size_t>(components) * count)) {
+    return;
+  }
+
+  const auto& v = uniforms_[static_cast<std::size_t>(u.index)];
+
+  const auto n = static_cast<GLsizei>(count);
+
+  // Unsigned uniforms only accept the unsigned variants of glUniform, and the other integer types only the signed
+  // ones, so the variant is picked by the uniform rather than by the values.
+
+  if (is_unsigned_type(v.type)) {
+    const auto* ui = static_cast<const GLuint*>(values);
+    switch (components) {
+      case 2:
+        glUniform2uiv(v.location, n, ui);
+        break;
+      case 3:
+        glUniform3uiv(v.location, n, ui);
+        break;
+      case 4:
+        glUniform4uiv(v.location, n, ui);
+        break;
+      default:
+        glUniform1uiv(v.location, n, ui);
+        break;
+    }
+    return;
+  }
+
+  const auto* i = static_cast<const GLint*>(values);
+
+  switch (components) {
+    case 2:
+      glUniform2iv(v.location, n, i);
+      break;
+    case 3:
+      glUniform3iv(v.location, n, i);
+      break;
+    case 4:
+      glUniform4iv(v.location, n, i);
+      break;
+    default:
+      glUniform1iv(v.location, n, i);
+      break;
+  }
+}
+
+void
+program::set_matrix3(const uniform_handle u, const float* m)
+{
+  if (update_shadow(u, m, sizeof(float) * 9)) {
+    glUniformMatrix3fv(uniforms_[static_cast<std::size_t>(u.index)].location, 1, GL_FALSE, m);
+  }
+}
+
+void
+program::set_matrix4(const uniform_handle u, const float* m)
+{
+  if (update_shadow(u, m, sizeof(float) * 16)) {
+    glUniformMatrix4fv(uniforms_[static_cast<std::size_t>(u.index)].location, 1, GL_FALSE, m);
+  }
+}
+
+void
+program::set_array(const uniform_handle u, const float* values, const std::size_t count)
+{
+  if (!u.valid()) {
+    return;
+  }
+
+  const auto& v = uniforms_[static_cast<std::size_t>(u.index)];
+
+  if (!is_float_type(v.type)) {
+    return;
+  }
+
+  const auto n = std::min(count, static_cast<std::size_t>(v.array_size));
+
+  if (!update_shadow(u, values, type_size(v.type) * n)) {
+    return;
+  }
+
+  const auto c = static_cast<GLsizei>(n);
+
+  switch (v.type) {
+    case GL_FLOAT_VEC2:
+      glUniform2fv(v.location, c, values);
+      break;
+    case GL_FLOAT_VEC3:
+      glUniform3fv(v.location, c, values);
+      break;
+    case GL_FLOAT_VEC4:
+      glUniform4fv(v.location, c, values);
+      break;
+    case GL_FLOAT_MAT2:
+      glUniformMatrix2fv(v.location, c, GL_FALSE, values);
+      break;
+    case GL_FLOAT_MAT3:
+      glUniformMatrix3fv(v.location, c, GL_FALSE, values);
+      break;
+    case GL_FLOAT_MAT4:
+      glUniformMatrix4fv(v.location, c, GL_FALSE, values);
+      break;
+    case GL_FLOAT_MAT2x3:
+      glUniformMatrix2x3fv(v.location, c, GL_FALSE, values);
+      break;
+    case GL_FLOAT_MAT2x4:
+      glUniformMatrix2x4fv(v.location, c, GL_FALSE, values);
+      break;
+    case GL_FLOAT_MAT3x2:
+      glUniformMatrix3x2fv(v.location, c, GL_FALSE, values);
+      break;
+    case GL_FLOAT_MAT3x4:
+      glUniformMatrix3x4fv(v.location, c, GL_FALSE, values);
+      break;
+    case GL_FLOAT_MAT4x2:
+      glUniformMatrix4x2fv(v.location, c, GL_FALSE, values);
+      break;
+    case GL_FLOAT_MAT4x3:
+      glUniformMatrix4x3fv(v.location, c, GL_FALSE, values);
+      break;
+    default:
+      glUniform1fv(v.location, c, values);
+      break;
+  }
+}
+
+void
+program::set_array(const uniform_handle u, const int* values, const std::size_t count)
+{
+  if (!u.valid()) {
+    return;
+  }
+
+  const auto& v = uniforms_[static_cast<std::size_t>(u.index)];
+
+  if (is_float_type(v.type)) {
+    return;
+  }
+
+  set_integers(u, values, integer_components(v.type), std::min(count, static_cast<std::size_t>(v.array_size)));
+}
+
+void
+program::set_array(const uniform_handle u, const unsigned int* values, const std::size_t count)
+{
+  if (!u.valid()) {
+    return;
+  }
+
+  const auto& v = uniforms_[static_cast<std::size_t>(u.index)];
+
+  if (is_float_type(v.type)) {
+    return;
+  }
+
+  set_integers(u, values, integer_components(v.type), std::min(count, static_cast<std::size_t>(v.array_size)));
+}
+
+auto
+program::upload_count() const -> std::uint64_t
+{
+  return upload_count_;
+}
+
+auto
+program::skip_count() const -> std::uint64_t
+{
+  return skip_count_;
+}
+
+void
+program::name_table::build(const std::vector<variable>& variables)
+{
+  // The table is kept at most half full, so that probe sequences stay short.
+
+  std::size_t capacity{ 8 };
+
+  while (capacity < (variables.size() * 4)) {
+    capacity *= 2;
+  }
+
+  slots_.assign(capacity, slot{});
+
+  for (std::size_t i = 0; i < variables.size(); i++) {
+
+    const auto& name = variables[i].name;
+
+    insert(variables, name.c_str(), static_cast<int>(i));
+
+    const auto stripped = strip_array_suffix(name);
+    if (stripped != name) {
+      insert(variables, stripped.c_str(), static_cast<int>(i));
+    }
+  }
+}
+
+void
+program::name_table::insert(const std::vector<variable>& variables, const char* name, const int index)
+{
+  if (find(variables, name) >= 0) {
+    return;
+  }
+
+  const auto hash = hash_name(name);
+
+  const auto mask = slots_.size() - 1;
+
+  for (auto i = static_cast<std::size_t>(hash) & mask;; i = (i + 1) & mask) {
+    if (slots_[i].index < 0) {
+      slots_[i].hash = hash;
+      slots_[i].index = index;
+      return;
+    }
+  }
+}
+
+auto
+program::name_table::find(const std::vector<variable>& variables, const char* name) const -> int
+{
+  if (slots_.empty()) {
+    return -1;
+  }
+
+  const auto hash = hash_name(name);
+
+  const auto mask = slots_.size() - 1;
+
+  for (auto i = static_cast<std::size_t>(hash) & mask;; i = (i + 1) & mask) {
+
+    const auto& s = slots_[i];
+
+    if (s.index < 0) {
+      return -1;
+    }
+
+    if (s.hash != hash) {
+      continue;
+    }
+
+    // Names that were inserted without their array suffix only match the prefix of the stored name.
+
+    const auto& stored = variables[static_cast<std::size_t>(s.index)].name;
+
+    const auto length = std::strlen(name);
+
+    if ((stored == name) ||
+        ((stored.size() == length + 3) && (stored.compare(0, length, name) == 0) &&
+         (stored.compare(length, 3, "[0]") == 0))) {
+      return s.index;
+    }
+  }
+}
+
+} // namespace glow
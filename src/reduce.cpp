@@ -0,0 +1,265 @@
+#include "reduce.h"
+
+#include <atomic>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+
+namespace glow {
+
+namespace {
+
+template<typename T>
+auto
+scalar_min_max(const T* values, const std::size_t count, const std::size_t stride) -> value_range
+{
+  value_range r{ std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity() };
+
+  // NaN fails both comparisons, so it never becomes an extreme.
+  for (std::size_t i = 0; i < count; i++) {
+    const auto v = static_cast<double>(values[i * stride]);
+    r.min = (v < r.min) ? v : r.min;
+    r.max = (v > r.max) ? v : r.max;
+  }
+
+  return r;
+}
+
+template<typename T>
+auto
+scalar_sum(const T* values, const std::size_t count, const std::size_t stride) -> reduce_sum
+{
+  reduce_sum s{ 0.0, 0 };
+
+  for (std::size_t i = 0; i < count; i++) {
+    const auto v = static_cast<double>(values[i * stride]);
+    if (v == v) {
+      s.sum += v;
+      s.count++;
+    }
+  }
+
+  return s;
+}
+
+template<typename T>
+auto
+scalar_min_max_contiguous(const T* values, const std::size_t count) -> value_range
+{
+  return scalar_min_max(values, count, 1);
+}
+
+template<typename T>
+auto
+scalar_sum_contiguous(const T* values, const std::size_t count) -> reduce_sum
+{
+  return scalar_sum(values, count, 1);
+}
+
+const reduce_kernels scalar_kernels{
+  &scalar_min_max_contiguous<float>, &scalar_min_max_contiguous<double>, &scalar_min_max_contiguous<std::int16_t>,
+  &scalar_sum_contiguous<float>,     &scalar_sum_contiguous<double>,     &scalar_sum_contiguous<std::int16_t>,
+};
+
+struct cpu_features final
+{
+  bool sse2{ false };
+
+  bool avx2{ false };
+
+  /// @brief Whether AVX-512 F and BW are both available, since the 16-bit kernels need BW.
+  bool avx512{ false };
+};
+
+auto
+detect_cpu_features() -> cpu_features
+{
+  cpu_features features;
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+  // These also check that the OS saves the wider registers.
+  __builtin_cpu_init();
+  features.sse2 = __builtin_cpu_supports("sse2");
+  features.avx2 = __builtin_cpu_supports("avx2");
+  features.avx512 = __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw");
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+  int info[4]{};
+  __cpuid(info, 0);
+  const auto max_leaf = info[0];
+
+  __cpuid(info, 1);
+  features.sse2 = (info[3] & (1 << 26)) != 0;
+  const auto os_saves_ymm = ((info[2] & (1 << 27)) != 0) && ((_xgetbv(0) & 0x6) == 0x6);
+  const auto os_saves_zmm = os_saves_ymm && ((_xgetbv(0) & 0xe0) == 0xe0);
+
+  if (max_leaf >= 7) {
+    __cpuidex(info, 7, 0);
+    features.avx2 = os_saves_ymm && ((info[1] & (1 << 5)) != 0);
+    features.avx512 = os_saves_zmm && ((info[1] & (1 << 16)) != 0) && ((info[1] & (1 << 30)) != 0);
+  }
+#endif
+
+  return features;
+}
+
+auto
+get_cpu_features() -> const cpu_features&
+{
+  static const cpu_features features = detect_cpu_features();
+  return features;
+}
+
+/// @brief Gets the kernels of an instruction set, if they were built and the CPU supports them.
+auto
+find_kernels(const simd_level level) -> const reduce_kernels*
+{
+  switch (level) {
+    case simd_level::scalar:
+      return &scalar_kernels;
+    case simd_level::sse2:
+      return get_cpu_features().sse2 ? get_sse2_kernels() : nullptr;
+    case simd_level::avx2:
+      return get_cpu_features().avx2 ? get_avx2_kernels() : nullptr;
+    case simd_level::avx512:
+      return get_cpu_features().avx512 ? get_avx512_kernels() : nullptr;
+    case simd_level::neon:
+      // NEON kernels are only built where it is part of the baseline, so there is nothing to check.
+      return get_neon_kernels();
+    case simd_level::wasm_simd128:
+      // A module with SIMD instructions cannot load at all without support for them, so nothing to check here either.
+      return get_wasm_kernels();
+  }
+  return nullptr;
+}
+
+auto
+pick_simd_level() -> simd_level
+{
+  const simd_level preferred[]{
+    simd_level::avx512, simd_level::avx2, simd_level::sse2, simd_level::neon, simd_level::wasm_simd128,
+  };
+
+  for (const auto level : preferred) {
+    if (find_kernels(level)) {
+      return level;
+    }
+  }
+
+  return simd_level::scalar;
+}
+
+struct dispatch final
+{
+  std::atomic<simd_level> level{ pick_simd_level() };
+
+  std::atomic<const reduce_kernels*> kernels{ find_kernels(level.load()) };
+};
+
+auto
+get_dispatch() -> dispatch&
+{
+  static dispatch d;
+  return d;
+}
+
+auto
+kernels() -> const reduce_kernels&
+{
+  return *get_dispatch().kernels.load(std::memory_order_relaxed);
+}
+
+auto
+mean(const reduce_sum& s) -> double
+{
+  return (s.count > 0) ? (s.sum / static_cast<double>(s.count)) : std::numeric_limits<double>::quiet_NaN();
+}
+
+} // namespace
+
+auto
+reduce_min_max(const float* values, const std::size_t count, const std::size_t stride) -> value_range
+{
+  return (stride == 1) ? kernels().min_max_f32(values, count) : scalar_min_max(values, count, stride);
+}
+
+auto
+reduce_min_max(const double* values, const std::size_t count, const std::size_t stride) -> value_range
+{
+  return (stride == 1) ? kernels().min_max_f64(values, count) : scalar_min_max(values, count, stride);
+}
+
+auto
+reduce_min_max(const std::int16_t* values, const std::size_t count, const std::size_t stride) -> value_range
+{
+  return (stride == 1) ? kernels().min_max_i16(values, count) : scalar_min_max(values, count, stride);
+}
+
+auto
+reduce_mean(const float* values, const std::size_t count, const std::size_t stride) -> double
+{
+  return mean((stride == 1) ? kernels().sum_f32(values, count) : scalar_sum(values, count, stride));
+}
+
+auto
+reduce_mean(const double* values, const std::size_t count, const std::size_t stride) -> double
+{
+  return mean((stride == 1) ? kernels().sum_f64(values, count) : scalar_sum(values, count, stride));
+}
+
+auto
+reduce_mean(const std::int16_t* values, const std::size_t count, const std::size_t stride) -> double
+{
+  return mean((stride == 1) ? kernels().sum_i16(values, count) : scalar_sum(values, count, stride));
+}
+
+auto
+is_simd_level_supported(const simd_level level) -> bool
+{
+  return find_kernels(level) != nullptr;
+}
+
+auto
+get_simd_level() -> simd_level
+{
+  return get_dispatch().level.load();
+}
+
+void
+set_simd_level(const simd_level level)
+{
+  const auto* k = find_kernels(level);
+  if (!k) {
+    throw std::invalid_argument(std::string("The ") + get_simd_level_name(level) + " kernels are not supported here.");
+  }
+
+  auto& d = get_dispatch();
+  d.kernels.store(k);
+  d.level.store(level);
+}
+
+auto
+get_simd_level_name(const simd_level level) -> const char*
+{
+  switch (level) {
+    case simd_level::scalar:
+      return "scalar";
+    case simd_level::sse2:
+      return "SSE2";
+    case simd_level::avx2:
+      return "AVX2";
+    case simd_level::avx512:
+      return "AVX-512";
+    case simd_level::neon:
+      return "NEON";
+    case simd_level::wasm_simd128:
+      return "WebAssembly SIMD";
+  }
+  return "unknown";
+}
+
+} // namespace glow
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <glow/reduce.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace glow {
+
+/// @brief The sum of a set of values, and how many there were (not counting NaN).
+struct reduce_sum final
+{
+  double sum;
+
+  std::uint64_t count;
+};
+
+/// @brief The reduction kernels for one instruction set, which all work on contiguous values.
+struct reduce_kernels final
+{
+  value_range (*min_max_f32)(const float*, std::size_t);
+
+  value_range (*min_max_f64)(const double*, std::size_t);
+
+  value_range (*min_max_i16)(const std::int16_t*, std::size_t);
+
+  reduce_sum (*sum_f32)(const float*, std::size_t);
+
+  reduce_sum (*sum_f64)(const double*, std::size_t);
+
+  reduce_sum (*sum_i16)(const std::int16_t*, std::size_t);
+};
+
+// Each of these is defined in its own file, which is built with the flags that its instruction set needs. They return
+// null when the target has no such instruction set, and do not check whether the CPU supports it.
+
+auto
+get_sse2_kernels() -> const reduce_kernels*;
+
+auto
+get_avx2_kernels() -> const reduce_kernels*;
+
+auto
+get_avx512_kernels() -> const reduce_kernels*;
+
+auto
+get_neon_kernels() -> const reduce_kernels*;
+
+auto
+get_wasm_kernels() -> const reduce_kernels*;
+
+} // namespace glow
@@ -0,0 +1,297 @@
+#include "reduce.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define GLOW_REDUCE_AVX512
+#endif
+
+#ifdef GLOW_REDUCE_AVX512
+#include <immintrin.h>
+#include <math.h>
+#endif
+
+namespace glow {
+
+#ifdef GLOW_REDUCE_AVX512
+
+namespace {
+
+// The kernels avoid the standard library, since this file is built with flags that the rest of the library is not
+// built with, and inline functions instantiated here could end up being used on CPUs without AVX-512.
+
+/// @brief The number of values summed before the integer lane counters are flushed, so that they cannot overflow.
+constexpr std::size_t sum_block{ std::size_t{ 1 } << 19 };
+
+auto
+min_max_f32(const float* values, const std::size_t count) -> value_range
+{
+  __m512 lo0 = _mm512_set1_ps(INFINITY);
+  __m512 lo1 = lo0;
+  __m512 hi0 = _mm512_set1_ps(-INFINITY);
+  __m512 hi1 = hi0;
+
+  std::size_t i{ 0 };
+
+  // With the value as the first operand, a NaN value gives back the accumulator, so NaN is skipped.
+  for (; (i + 32) <= count; i += 32) {
+    const auto a = _mm512_loadu_ps(values + i);
+    const auto b = _mm512_loadu_ps(values + i + 16);
+    lo0 = _mm512_min_ps(a, lo0);
+    lo1 = _mm512_min_ps(b, lo1);
+    hi0 = _mm512_max_ps(a, hi0);
+    hi1 = _mm512_max_ps(b, hi1);
+  }
+
+  float lo[16];
+  float hi[16];
+  _mm512_storeu_ps(lo, _mm512_min_ps(lo0, lo1));
+  _mm512_storeu_ps(hi, _mm512_max_ps(hi0, hi1));
+
+  float min = lo[0];
+  float max = hi[0];
+  for (int k = 1; k < 16; k++) {
+    min = (lo[k] < min) ? lo[k] : min;
+    max = (hi[k] > max) ? hi[k] : max;
+  }
+
+  for (; i < count; i++) {
+    const auto v = values[i];
+    min = (v < min) ? v : min;
+    max = (v > max) ? v : max;
+  }
+
+  return { min, max };
+}
+
+auto
+min_max_f64(const double* values, const std::size_t count) -> value_range
+{
+  __m512d lo0 = _mm512_set1_pd(INFINITY);
+  __m512d lo1 = lo0;
+  __m512d hi0 = _mm512_set1_pd(-INFINITY);
+  __m512d hi1 = hi0;
+
+  std::size_t i{ 0 };
+
+  for (; (i + 16) <= count; i += 16) {
+    const auto a = _mm512_loadu_pd(values + i);
+    const auto b = _mm512_loadu_pd(values + i + 8);
+    lo0 = _mm512_min_pd(a, lo0);
+    lo1 = _mm512_min_pd(b, lo1);
+    hi0 = _mm512_max_pd(a, hi0);
+    hi1 = _mm512_max_pd(b, hi1);
+  }
+
+  double lo[8];
+  double hi[8];
+  _mm512_storeu_pd(lo, _mm512_min_pd(lo0, lo1));
+  _mm512_storeu_pd(hi, _mm512_max_pd(hi0, hi1));
+
+  double min = lo[0];
+  double max = hi[0];
+  for (int k = 1; k < 8; k++) {
+    min = (lo[k] < min) ? lo[k] : min;
+    max = (hi[k] > max) ? hi[k] : max;
+  }
+
+  for (; i < count; i++) {
+    const auto v = values[i];
+    min = (v < min) ? v : min;
+    max = (v > max) ? v : max;
+  }
+
+  return { min, max };
+}
+
+auto
+min_max_i16(const std::int16_t* values, const std::size_t count) -> value_range
+{
+  if (count == 0) {
+    return { INFINITY, -INFINITY };
+  }
+
+  __m512i lo = _mm512_set1_epi16(32767);
+  __m512i hi = _mm512_set1_epi16(-32768);
+
+  std::size_t i{ 0 };
+
+  for (; (i + 32) <= count; i += 32) {
+    const auto v = _mm512_loadu_si512(values + i);
+    lo = _mm512_min_epi16(v, lo);
+    hi = _mm512_max_epi16(v, hi);
+  }
+
+  std::int16_t lo_lanes[32];
+  std::int16_t hi_lanes[32];
+  _mm512_storeu_si512(lo_lanes, lo);
+  _mm512_storeu_si512(hi_lanes, hi);
+
+  std::int16_t min = lo_lanes[0];
+  std::int16_t max = hi_lanes[0];
+  for (int k = 1; k < 32; k++) {
+    min = (lo_lanes[k] < min) ? lo_lanes[k] : min;
+    max = (hi_lanes[k] > max) ? hi_lanes[k] : max;
+  }
+
+  for (; i < count; i++) {
+    min = (values[i] < min) ? values[i] : min;
+    max = (values[i] > max) ? values[i] : max;
+  }
+
+  return { static_cast<double>(min), static_cast<double>(max) };
+}
+
+auto
+sum_f32(const float* values, const std::size_t count) -> reduce_sum
+{
+  reduce_sum s{ 0.0, 0 };
+
+  const auto vector_end = count & ~std::size_t{ 15 };
+
+  const auto one = _mm512_set1_epi32(1);
+
+  std::size_t i{ 0 };
+
+  while (i < vector_end) {
+
+    const auto block_end = ((vector_end - i) > sum_block) ? (i + sum_block) : vector_end;
+
+    __m512d sum0 = _mm512_setzero_pd();
+    __m512d sum1 = _mm512_setzero_pd();
+    __m512i counts = _mm512_setzero_si512();
+
+    // Values are widened to double before being added, so that long columns do not lose precision. NaN lanes are
+    // left out of the additions with the comparison mask.
+    for (; i < block_end; i += 16) {
+      const auto v = _mm512_loadu_ps(values + i);
+      const auto ordered = _mm512_cmp_ps_mask(v, v, _CMP_ORD_Q);
+      const auto low = _mm512_cvtps_pd(_mm512_castps512_ps256(v));
+      const auto high = _mm512_cvtps_pd(_mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(v), 1)));
+      sum0 = _mm512_mask_add_pd(sum0, static_cast<__mmask8>(ordered), sum0, low);
+      sum1 = _mm512_mask_add_pd(sum1, static_cast<__mmask8>(ordered >> 8), sum1, high);
+      counts = _mm512_mask_add_epi32(counts, ordered, counts, one);
+    }
+
+    double sums[8];
+    _mm512_storeu_pd(sums, _mm512_add_pd(sum0, sum1));
+    for (int k = 0; k < 8; k++) {
+      s.sum += sums[k];
+    }
+
+    std::int32_t count_lanes[16];
+    _mm512_storeu_si512(count_lanes, counts);
+    for (int k = 0; k < 16; k++) {
+      s.count += static_cast<std::uint64_t>(count_lanes[k]);
+    }
+  }
+
+  for (; i < count; i++) {
+    if (values[i] == values[i]) {
+      s.sum += static_cast<double>(values[i]);
+      s.count++;
+    }
+  }
+
+  return s;
+}
+
+auto
+sum_f64(const double* values, const std::size_t count) -> reduce_sum
+{
+  __m512d sum0 = _mm512_setzero_pd();
+  __m512d sum1 = _mm512_setzero_pd();
+  __m512i counts = _mm512_setzero_si512();
+
+  const auto one = _mm512_set1_epi64(1);
+
+  std::size_t i{ 0 };
+
+  for (; (i + 16) <= count; i += 16) {
+    const auto a = _mm512_loadu_pd(values + i);
+    const auto b = _mm512_loadu_pd(values + i + 8);
+    const auto a_ordered = _mm512_cmp_pd_mask(a, a, _CMP_ORD_Q);
+    const auto b_ordered = _mm512_cmp_pd_mask(b, b, _CMP_ORD_Q);
+    sum0 = _mm512_mask_add_pd(sum0, a_ordered, sum0, a);
+    sum1 = _mm512_mask_add_pd(sum1, b_ordered, sum1, b);
+    counts = _mm512_mask_add_epi64(counts, a_ordered, counts, one);
+    counts = _mm512_mask_add_epi64(counts, b_ordered, counts, one);
+  }
+
+  double sums[8];
+  _mm512_storeu_pd(sums, _mm512_add_pd(sum0, sum1));
+
+  std::int64_t count_lanes[8];
+  _mm512_storeu_si512(count_lanes, counts);
+
+  reduce_sum s{ 0.0, 0 };
+  for (int k = 0; k < 8; k++) {
+    s.sum += sums[k];
+    s.count += static_cast<std::uint64_t>(count_lanes[k]);
+  }
+
+  for (; i < count; i++) {
+    if (values[i] == values[i]) {
+      s.sum += values[i];
+      s.count++;
+    }
+  }
+
+  return s;
+}
+
+auto
+sum_i16(const std::int16_t* values, const std::size_t count) -> reduce_sum
+{
+  std::int64_t total{ 0 };
+
+  const auto ones = _mm512_set1_epi16(1);
+
+  const auto vector_end = count & ~std::size_t{ 31 };
+
+  std::size_t i{ 0 };
+
+  while (i < vector_end) {
+
+    const auto block_end = ((vector_end - i) > sum_block) ? (i + sum_block) : vector_end;
+
+    __m512i sums = _mm512_setzero_si512();
+
+    for (; i < block_end; i += 32) {
+      const auto v = _mm512_loadu_si512(values + i);
+      sums = _mm512_add_epi32(sums, _mm512_madd_epi16(v, ones));
+    }
+
+    std::int32_t lanes[16];
+    _mm512_storeu_si512(lanes, sums);
+    for (int k = 0; k < 16; k++) {
+      total += lanes[k];
+    }
+  }
+
+  for (; i < count; i++) {
+    total += values[i];
+  }
+
+  return { static_cast<double>(total), count };
+}
+
+const reduce_kernels kernels{ &min_max_f32, &min_max_f64, &min_max_i16, &sum_f32, &sum_f64, &sum_i16 };
+
+} // namespace
+
+auto
+get_avx512_kernels() -> const reduce_kernels*
+{
+  return &kernels;
+}
+
+#else
+
+auto
+get_avx512_kernels() -> const reduce_kernels*
+{
+  return nullptr;
+}
+
+#endif
+
+} // namespace glow
@@ -0,0 +1,239 @@
+#include "reduce.h"
+
+// NEON is part of the AArch64 baseline, so these kernels need no extra flags and no check at run time. The optional
+// NEON unit of 32-bit ARM has no double precision lanes, so it is left to the scalar kernels.
+#if defined(__aarch64__) || defined(_M_ARM64)
+#define GLOW_REDUCE_NEON
+#endif
+
+#ifdef GLOW_REDUCE_NEON
+#include <arm_neon.h>
+#include <math.h>
+#endif
+
+namespace glow {
+
+#ifdef GLOW_REDUCE_NEON
+
+namespace {
+
+/// @brief The number of values summed before the integer lane counters are flushed, so that they cannot overflow.
+constexpr std::size_t sum_block{ std::size_t{ 1 } << 17 };
+
+auto
+min_max_f32(const float* values, const std::size_t count) -> value_range
+{
+  float32x4_t lo0 = vdupq_n_f32(INFINITY);
+  float32x4_t lo1 = lo0;
+  float32x4_t hi0 = vdupq_n_f32(-INFINITY);
+  float32x4_t hi1 = hi0;
+
+  std::size_t i{ 0 };
+
+  // The "number" variants of min and max return the other operand when one of them is NaN, so NaN is skipped.
+  for (; (i + 8) <= count; i += 8) {
+    const auto a = vld1q_f32(values + i);
+    const auto b = vld1q_f32(values + i + 4);
+    lo0 = vminnmq_f32(lo0, a);
+    lo1 = vminnmq_f32(lo1, b);
+    hi0 = vmaxnmq_f32(hi0, a);
+    hi1 = vmaxnmq_f32(hi1, b);
+  }
+
+  float min = vminnmvq_f32(vminnmq_f32(lo0, lo1));
+  float max = vmaxnmvq_f32(vmaxnmq_f32(hi0, hi1));
+
+  for (; i < count; i++) {
+    const auto v = values[i];
+    min = (v < min) ? v : min;
+    max = (v > max) ? v : max;
+  }
+
+  return { min, max };
+}
+
+auto
+min_max_f64(const double* values, const std::size_t count) -> value_range
+{
+  float64x2_t lo0 = vdupq_n_f64(INFINITY);
+  float64x2_t lo1 = lo0;
+  float64x2_t hi0 = vdupq_n_f64(-INFINITY);
+  float64x2_t hi1 = hi0;
+
+  std::size_t i{ 0 };
+
+  for (; (i + 4) <= count; i += 4) {
+    const auto a = vld1q_f64(values + i);
+    const auto b = vld1q_f64(values + i + 2);
+    lo0 = vminnmq_f64(lo0, a);
+    lo1 = vminnmq_f64(lo1, b);
+    hi0 = vmaxnmq_f64(hi0, a);
+    hi1 = vmaxnmq_f64(hi1, b);
+  }
+
+  double min = vminnmvq_f64(vminnmq_f64(lo0, lo1));
+  double max = vmaxnmvq_f64(vmaxnmq_f64(hi0, hi1));
+
+  for (; i < count; i++) {
+    const auto v = values[i];
+    min = (v < min) ? v : min;
+    max = (v > max) ? v : max;
+  }
+
+  return { min, max };
+}
+
+auto
+min_max_i16(const std::int16_t* values, const std::size_t count) -> value_range
+{
+  if (count == 0) {
+    return { INFINITY, -INFINITY };
+  }
+
+  int16x8_t lo = vdupq_n_s16(32767);
+  int16x8_t hi = vdupq_n_s16(-32768);
+
+  std::size_t i{ 0 };
+
+  for (; (i + 8) <= count; i += 8) {
+    const auto v = vld1q_s16(values + i);
+    lo = vminq_s16(lo, v);
+    hi = vmaxq_s16(hi, v);
+  }
+
+  std::int16_t min = vminvq_s16(lo);
+  std::int16_t max = vmaxvq_s16(hi);
+
+  for (; i < count; i++) {
+    min = (values[i] < min) ? values[i] : min;
+    max = (values[i] > max) ? values[i] : max;
+  }
+
+  return { static_cast<double>(min), static_cast<double>(max) };
+}
+
+auto
+sum_f32(const float* values, const std::size_t count) -> reduce_sum
+{
+  reduce_sum s{ 0.0, 0 };
+
+  const auto vector_end = count & ~std::size_t{ 3 };
+
+  std::size_t i{ 0 };
+
+  while (i < vector_end) {
+
+    const auto block_end = ((vector_end - i) > sum_block) ? (i + sum_block) : vector_end;
+
+    float64x2_t sum0 = vdupq_n_f64(0.0);
+    float64x2_t sum1 = vdupq_n_f64(0.0);
+    uint32x4_t counts = vdupq_n_u32(0);
+
+    // Values are widened to double before being added, so that long columns do not lose precision. NaN lanes are
+    // zeroed with the comparison mask, and since each lane of the mask is either zero or all ones, subtracting it
+    // counts the other lanes.
+    for (; i < block_end; i += 4) {
+      const auto v = vld1q_f32(values + i);
+      const auto ordered = vceqq_f32(v, v);
+      const auto masked = vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(v), ordered));
+      sum0 = vaddq_f64(sum0, vcvt_f64_f32(vget_low_f32(masked)));
+      sum1 = vaddq_f64(sum1, vcvt_high_f64_f32(masked));
+      counts = vsubq_u32(counts, ordered);
+    }
+
+    s.sum += vaddvq_f64(vaddq_f64(sum0, sum1));
+    s.count += vaddlvq_u32(counts);
+  }
+
+  for (; i < count; i++) {
+    if (values[i] == values[i]) {
+      s.sum += static_cast<double>(values[i]);
+      s.count++;
+    }
+  }
+
+  return s;
+}
+
+auto
+sum_f64(const double* values, const std::size_t count) -> reduce_sum
+{
+  float64x2_t sum0 = vdupq_n_f64(0.0);
+  float64x2_t sum1 = vdupq_n_f64(0.0);
+  uint64x2_t counts = vdupq_n_u64(0);
+
+  std::size_t i{ 0 };
+
+  for (; (i + 4) <= count; i += 4) {
+    const auto a = vld1q_f64(values + i);
+    const auto b = vld1q_f64(values + i + 2);
+    const auto a_ordered = vceqq_f64(a, a);
+    const auto b_ordered = vceqq_f64(b, b);
+    sum0 = vaddq_f64(sum0, vreinterpretq_f64_u64(vandq_u64(vreinterpretq_u64_f64(a), a_ordered)));
+    sum1 = vaddq_f64(sum1, vreinterpretq_f64_u64(vandq_u64(vreinterpretq_u64_f64(b), b_ordered)));
+    counts = vsubq_u64(counts, a_ordered);
+    counts = vsubq_u64(counts, b_ordered);
+  }
+
+  reduce_sum s{ vaddvq_f64(vaddq_f64(sum0, sum1)), vaddvq_u64(counts) };
+
+  for (; i < count; i++) {
+    if (values[i] == values[i]) {
+      s.sum += values[i];
+      s.count++;
+    }
+  }
+
+  return s;
+}
+
+auto
+sum_i16(const std::int16_t* values, const std::size_t count) -> reduce_sum
+{
+  std::int64_t total{ 0 };
+
+  const auto vector_end = count & ~std::size_t{ 7 };
+
+  std::size_t i{ 0 };
+
+  while (i < vector_end) {
+
+    const auto block_end = ((vector_end - i) > sum_block) ? (i + sum_block) : vector_end;
+
+    int32x4_t sums = vdupq_n_s32(0);
+
+    for (; i < block_end; i += 8) {
+      sums = vpadalq_s16(sums, vld1q_s16(values + i));
+    }
+
+    total += vaddlvq_s32(sums);
+  }
+
+  for (; i < count; i++) {
+    total += values[i];
+  }
+
+  return { static_cast<double>(total), count };
+}
+
+const reduce_kernels kernels{ &min_max_f32, &min_max_f64, &min_max_i16, &sum_f32, &sum_f64, &sum_i16 };
+
+} // namespace
+
+auto
+get_neon_kernels() -> const reduce_kernels*
+{
+  return &kernels;
+}
+
+#else
+
+auto
+get_neon_kernels() -> const reduce_kernels*
+{
+  return nullptr;
+}
+
+#endif
+
+} // namespace glow
@@ -0,0 +1,278 @@
+#include "reduce.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define GLOW_REDUCE_SSE2
+#endif
+
+#ifdef GLOW_REDUCE_SSE2
+#include <emmintrin.h>
+#include <math.h>
+#endif
+
+namespace glow {
+
+#ifdef GLOW_REDUCE_SSE2
+
+namespace {
+
+// The kernels avoid the standard library, since this file may be built with flags that the rest of the library is not
+// built with, and inline functions instantiated here could end up being used elsewhere.
+
+/// @brief The number of values summed before the integer lane counters are flushed, so that they cannot overflow.
+constexpr std::size_t sum_block{ std::size_t{ 1 } << 17 };
+
+auto
+min_max_f32(const float* values, const std::size_t count) -> value_range
+{
+  __m128 lo0 = _mm_set1_ps(INFINITY);
+  __m128 lo1 = lo0;
+  __m128 hi0 = _mm_set1_ps(-INFINITY);
+  __m128 hi1 = hi0;
+
+  std::size_t i{ 0 };
+
+  // With the value as the first operand, a NaN value gives back the accumulator, so NaN is skipped.
+  for (; (i + 8) <= count; i += 8) {
+    const auto a = _mm_loadu_ps(values + i);
+    const auto b = _mm_loadu_ps(values + i + 4);
+    lo0 = _mm_min_ps(a, lo0);
+    lo1 = _mm_min_ps(b, lo1);
+    hi0 = _mm_max_ps(a, hi0);
+    hi1 = _mm_max_ps(b, hi1);
+  }
+
+  float lo[4];
+  float hi[4];
+  _mm_storeu_ps(lo, _mm_min_ps(lo0, lo1));
+  _mm_storeu_ps(hi, _mm_max_ps(hi0, hi1));
+
+  float min = lo[0];
+  float max = hi[0];
+  for (int k = 1; k < 4; k++) {
+    min = (lo[k] < min) ? lo[k] : min;
+    max = (hi[k] > max) ? hi[k] : max;
+  }
+
+  for (; i < count; i++) {
+    const auto v = values[i];
+    min = (v < min) ? v : min;
+    max = (v > max) ? v : max;
+  }
+
+  return { min, max };
+}
+
+auto
+min_max_f64(const double* values, const std::size_t count) -> value_range
+{
+  __m128d lo0 = _mm_set1_pd(INFINITY);
+  __m128d lo1 = lo0;
+  __m128d hi0 = _mm_set1_pd(-INFINITY);
+  __m128d hi1 = hi0;
+
+  std::size_t i{ 0 };
+
+  for (; (i + 4) <= count; i += 4) {
+    const auto a = _mm_loadu_pd(values + i);
+    const auto b = _mm_loadu_pd(values + i + 2);
+    lo0 = _mm_min_pd(a, lo0);
+    lo1 = _mm_min_pd(b, lo1);
+    hi0 = _mm_max_pd(a, hi0);
+    hi1 = _mm_max_pd(b, hi1);
+  }
+
+  double lo[2];
+  double hi[2];
+  _mm_storeu_pd(lo, _mm_min_pd(lo0, lo1));
+  _mm_storeu_pd(hi, _mm_max_pd(hi0, hi1));
+
+  double min = (lo[1] < lo[0]) ? lo[1] : lo[0];
+  double max = (hi[1] > hi[0]) ? hi[1] : hi[0];
+
+  for (; i < count; i++) {
+    const auto v = values[i];
+    min = (v < min) ? v : min;
+    max = (v > max) ? v : max;
+  }
+
+  return { min, max };
+}
+
+auto
+min_max_i16(const std::int16_t* values, const std::size_t count) -> value_range
+{
+  if (count == 0) {
+    return { INFINITY, -INFINITY };
+  }
+
+  __m128i lo = _mm_set1_epi16(32767);
+  __m128i hi = _mm_set1_epi16(-32768);
+
+  std::size_t i{ 0 };
+
+  for (; (i + 8) <= count; i += 8) {
+    const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i));
+    lo = _mm_min_epi16(v, lo);
+    hi = _mm_max_epi16(v, hi);
+  }
+
+  std::int16_t lo_lanes[8];
+  std::int16_t hi_lanes[8];
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(lo_lanes), lo);
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(hi_lanes), hi);
+
+  std::int16_t min = lo_lanes[0];
+  std::int16_t max = hi_lanes[0];
+  for (int k = 1; k < 8; k++) {
+    min = (lo_lanes[k] < min) ? lo_lanes[k] : min;
+    max = (hi_lanes[k] > max) ? hi_lanes[k] : max;
+  }
+
+  for (; i < count; i++) {
+    min = (values[i] < min) ? values[i] : min;
+    max = (values[i] > max) ? values[i] : max;
+  }
+
+  return { static_cast<double>(min), static_cast<double>(max) };
+}
+
+auto
+sum_f32(const float* values, const std::size_t count) -> reduce_sum
+{
+  reduce_sum s{ 0.0, 0 };
+
+  const auto vector_end = count & ~std::size_t{ 3 };
+
+  std::size_t i{ 0 };
+
+  while (i < vector_end) {
+
+    const auto block_end = ((vector_end - i) > sum_block) ? (i + sum_block) : vector_end;
+
+    __m128d sum0 = _mm_setzero_pd();
+    __m128d sum1 = _mm_setzero_pd();
+    __m128i counts = _mm_setzero_si128();
+
+    // Values are widened to double before being added, so that long columns do not lose precision.
+    for (; i < block_end; i += 4) {
+      const auto v = _mm_loadu_ps(values + i);
+      const auto ordered = _mm_cmpord_ps(v, v);
+      const auto x = _mm_and_ps(v, ordered);
+      sum0 = _mm_add_pd(sum0, _mm_cvtps_pd(x));
+      sum1 = _mm_add_pd(sum1, _mm_cvtps_pd(_mm_movehl_ps(x, x)));
+      counts = _mm_sub_epi32(counts, _mm_castps_si128(ordered));
+    }
+
+    double sums[2];
+    _mm_storeu_pd(sums, _mm_add_pd(sum0, sum1));
+    s.sum += sums[0] + sums[1];
+
+    std::int32_t count_lanes[4];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(count_lanes), counts);
+    s.count += static_cast<std::uint64_t>(count_lanes[0]) + static_cast<std::uint64_t>(count_lanes[1]) +
+               static_cast<std::uint64_t>(count_lanes[2]) + static_cast<std::uint64_t>(count_lanes[3]);
+  }
+
+  for (; i < count; i++) {
+    if (values[i] == values[i]) {
+      s.sum += static_cast<double>(values[i]);
+      s.count++;
+    }
+  }
+
+  return s;
+}
+
+auto
+sum_f64(const double* values, const std::size_t count) -> reduce_sum
+{
+  __m128d sum0 = _mm_setzero_pd();
+  __m128d sum1 = _mm_setzero_pd();
+  __m128i counts = _mm_setzero_si128();
+
+  std::size_t i{ 0 };
+
+  for (; (i + 4) <= count; i += 4) {
+    const auto a = _mm_loadu_pd(values + i);
+    const auto b = _mm_loadu_pd(values + i + 2);
+    const auto a_ordered = _mm_cmpord_pd(a, a);
+    const auto b_ordered = _mm_cmpord_pd(b, b);
+    sum0 = _mm_add_pd(sum0, _mm_and_pd(a, a_ordered));
+    sum1 = _mm_add_pd(sum1, _mm_and_pd(b, b_ordered));
+    counts = _mm_sub_epi64(counts, _mm_castpd_si128(a_ordered));
+    counts = _mm_sub_epi64(counts, _mm_castpd_si128(b_ordered));
+  }
+
+  double sums[2];
+  _mm_storeu_pd(sums, _mm_add_pd(sum0, sum1));
+
+  std::int64_t count_lanes[2];
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(count_lanes), counts);
+
+  reduce_sum s{ sums[0] + sums[1], static_cast<std::uint64_t>(count_lanes[0] + count_lanes[1]) };
+
+  for (; i < count; i++) {
+    if (values[i] == values[i]) {
+      s.sum += values[i];
+      s.count++;
+    }
+  }
+
+  return s;
+}
+
+auto
+sum_i16(const std::int16_t* values, const std::size_t count) -> reduce_sum
+{
+  std::int64_t total{ 0 };
+
+  const auto ones = _mm_set1_epi16(1);
+
+  const auto vector_end = count & ~std::size_t{ 7 };
+
+  std::size_t i{ 0 };
+
+  while (i < vector_end) {
+
+    const auto block_end = ((vector_end - i) > sum_block) ? (i + sum_block) : vector_end;
+
+    __m128i sums = _mm_setzero_si128();
+
+    for (; i < block_end; i += 8) {
+      const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i));
+      sums = _mm_add_epi32(sums, _mm_madd_epi16(v, ones));
+    }
+
+    std::int32_t lanes[4];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), sums);
+    total += static_cast<std::int64_t>(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+  }
+
+  for (; i < count; i++) {
+    total += values[i];
+  }
+
+  return { static_cast<double>(total), count };
+}
+
+const reduce_kernels kernels{ &min_max_f32, &min_max_f64, &min_max_i16, &sum_f32, &sum_f64, &sum_i16 };
+
+} // namespace
+
+auto
+get_sse2_kernels() -> const reduce_kernels*
+{
+  return &kernels;
+}
+
+#else
+
+auto
+get_sse2_kernels() -> const reduce_kernels*
+{
+  return nullptr;
+}
+
+#endif
+
+} // namespace glow
@@ -0,0 +1,280 @@
+#include "reduce.h"
+
+// WebAssembly has no way of checking for SIMD support at run time, since a module that uses it fails to load where it
+// is not supported. So these kernels are only built when the library is built with -msimd128 (the GLOW_WASM_SIMD
+// option).
+#if defined(__wasm_simd128__)
+#define GLOW_REDUCE_WASM
+#endif
+
+#ifdef GLOW_REDUCE_WASM
+#include <math.h>
+#include <wasm_simd128.h>
+#endif
+
+namespace glow {
+
+#ifdef GLOW_REDUCE_WASM
+
+namespace {
+
+/// @brief The number of values summed before the integer lane counters are flushed, so that they cannot overflow.
+constexpr std::size_t sum_block{ std::size_t{ 1 } << 17 };
+
+auto
+min_max_f32(const float* values, const std::size_t count) -> value_range
+{
+  v128_t lo0 = wasm_f32x4_splat(INFINITY);
+  v128_t lo1 = lo0;
+  v128_t hi0 = wasm_f32x4_splat(-INFINITY);
+  v128_t hi1 = hi0;
+
+  std::size_t i{ 0 };
+
+  // The pseudo-minimum gives back its first operand unless the second one is smaller, so a NaN value is skipped.
+  for (; (i + 8) <= count; i += 8) {
+    const auto a = wasm_v128_load(values + i);
+    const auto b = wasm_v128_load(values + i + 4);
+    lo0 = wasm_f32x4_pmin(lo0, a);
+    lo1 = wasm_f32x4_pmin(lo1, b);
+    hi0 = wasm_f32x4_pmax(hi0, a);
+    hi1 = wasm_f32x4_pmax(hi1, b);
+  }
+
+  float lo[4];
+  float hi[4];
+  wasm_v128_store(lo, wasm_f32x4_pmin(lo0, lo1));
+  wasm_v128_store(hi, wasm_f32x4_pmax(hi0, hi1));
+
+  float min = lo[0];
+  float max = hi[0];
+  for (int k = 1; k < 4; k++) {
+    min = (lo[k] < min) ? lo[k] : min;
+    max = (hi[k] > max) ? hi[k] : max;
+  }
+
+  for (; i < count; i++) {
+    const auto v = values[i];
+    min = (v < min) ? v : min;
+    max = (v > max) ? v : max;
+  }
+
+  return { min, max };
+}
+
+auto
+min_max_f64(const double* values, const std::size_t count) -> value_range
+{
+  v128_t lo0 = wasm_f64x2_splat(INFINITY);
+  v128_t lo1 = lo0;
+  v128_t hi0 = wasm_f64x2_splat(-INFINITY);
+  v128_t hi1 = hi0;
+
+  std::size_t i{ 0 };
+
+  for (; (i + 4) <= count; i += 4) {
+    const auto a = wasm_v128_load(values + i);
+    const auto b = wasm_v128_load(values + i + 2);
+    lo0 = wasm_f64x2_pmin(lo0, a);
+    lo1 = wasm_f64x2_pmin(lo1, b);
+    hi0 = wasm_f64x2_pmax(hi0, a);
+    hi1 = wasm_f64x2_pmax(hi1, b);
+  }
+
+  double lo[2];
+  double hi[2];
+  wasm_v128_store(lo, wasm_f64x2_pmin(lo0, lo1));
+  wasm_v128_store(hi, wasm_f64x2_pmax(hi0, hi1));
+
+  double min = (lo[1] < lo[0]) ? lo[1] : lo[0];
+  double max = (hi[1] > hi[0]) ? hi[1] : hi[0];
+
+  for (; i < count; i++) {
+    const auto v = values[i];
+    min = (v < min) ? v : min;
+    max = (v > max) ? v : max;
+  }
+
+  return { min, max };
+}
+
+auto
+min_max_i16(const std::int16_t* values, const std::size_t count) -> value_range
+{
+  if (count == 0) {
+    return { INFINITY, -INFINITY };
+  }
+
+  v128_t lo = wasm_i16x8_splat(32767);
+  v128_t hi = wasm_i16x8_splat(-32768);
+
+  std::size_t i{ 0 };
+
+  for (; (i + 8) <= count; i += 8) {
+    const auto v = wasm_v128_load(values + i);
+    lo = wasm_i16x8_min(lo, v);
+    hi = wasm_i16x8_max(hi, v);
+  }
+
+  std::int16_t lo_lanes[8];
+  std::int16_t hi_lanes[8];
+  wasm_v128_store(lo_lanes, lo);
+  wasm_v128_store(hi_lanes, hi);
+
+  std::int16_t min = lo_lanes[0];
+  std::int16_t max = hi_lanes[0];
+  for (int k = 1; k < 8; k++) {
+    min = (lo_lanes[k] < min) ? lo_lanes[k] : min;
+    max = (hi_lanes[k] > max) ? hi_lanes[k] : max;
+  }
+
+  for (; i < count; i++) {
+    min = (values[i] < min) ? values[i] : min;
+    max = (values[i] > max) ? values[i] : max;
+  }
+
+  return { static_cast<double>(min), static_cast<double>(max) };
+}
+
+auto
+sum_f32(const float* values, const std::size_t count) -> reduce_sum
+{
+  reduce_sum s{ 0.0, 0 };
+
+  const auto vector_end = count & ~std::size_t{ 3 };
+
+  std::size_t i{ 0 };
+
+  while (i < vector_end) {
+
+    const auto block_end = ((vector_end - i) > sum_block) ? (i + sum_block) : vector_end;
+
+    v128_t sum0 = wasm_f64x2_splat(0.0);
+    v128_t sum1 = wasm_f64x2_splat(0.0);
+    v128_t counts = wasm_i32x4_splat(0);
+
+    // Values are widened to double before being added, so that long columns do not lose precision. NaN lanes are
+    // zeroed with the comparison mask, and since each lane of the mask is either zero or minus one, subtracting it
+    // counts the other lanes.
+    for (; i < block_end; i += 4) {
+      const auto v = wasm_v128_load(values + i);
+      const auto ordered = wasm_f32x4_eq(v, v);
+      const auto masked = wasm_v128_and(v, ordered);
+      sum0 = wasm_f64x2_add(sum0, wasm_f64x2_promote_low_f32x4(masked));
+      sum1 = wasm_f64x2_add(sum1, wasm_f64x2_promote_low_f32x4(wasm_i32x4_shuffle(masked, masked, 2, 3, 0, 1)));
+      counts = wasm_i32x4_sub(counts, ordered);
+    }
+
+    double sums[2];
+    wasm_v128_store(sums, wasm_f64x2_add(sum0, sum1));
+    s.sum += sums[0] + sums[1];
+
+    std::uint32_t count_lanes[4];
+    wasm_v128_store(count_lanes, counts);
+    for (int k = 0; k < 4; k++) {
+      s.count += count_lanes[k];
+    }
+  }
+
+  for (; i < count; i++) {
+    if (values[i] == values[i]) {
+      s.sum += static_cast<double>(values[i]);
+      s.count++;
+    }
+  }
+
+  return s;
+}
+
+auto
+sum_f64(const double* values, const std::size_t count) -> reduce_sum
+{
+  v128_t sum0 = wasm_f64x2_splat(0.0);
+  v128_t sum1 = wasm_f64x2_splat(0.0);
+  v128_t counts = wasm_i64x2_splat(0);
+
+  std::size_t i{ 0 };
+
+  for (; (i + 4) <= count; i += 4) {
+    const auto a = wasm_v128_load(values + i);
+    const auto b = wasm_v128_load(values + i + 2);
+    const auto a_ordered = wasm_f64x2_eq(a, a);
+    const auto b_ordered = wasm_f64x2_eq(b, b);
+    sum0 = wasm_f64x2_add(sum0, wasm_v128_and(a, a_ordered));
+    sum1 = wasm_f64x2_add(sum1, wasm_v128_and(b, b_ordered));
+    counts = wasm_i64x2_sub(counts, a_ordered);
+    counts = wasm_i64x2_sub(counts, b_ordered);
+  }
+
+  double sums[2];
+  wasm_v128_store(sums, wasm_f64x2_add(sum0, sum1));
+
+  std::uint64_t count_lanes[2];
+  wasm_v128_store(count_lanes, counts);
+
+  reduce_sum s{ sums[0] + sums[1], count_lanes[0] + count_lanes[1] };
+
+  for (; i < count; i++) {
+    if (values[i] == values[i]) {
+      s.sum += values[i];
+      s.count++;
+    }
+  }
+
+  return s;
+}
+
+auto
+sum_i16(const std::int16_t* values, const std::size_t count) -> reduce_sum
+{
+  std::int64_t total{ 0 };
+
+  const auto vector_end = count & ~std::size_t{ 7 };
+
+  std::size_t i{ 0 };
+
+  while (i < vector_end) {
+
+    const auto block_end = ((vector_end - i) > sum_block) ? (i + sum_block) : vector_end;
+
+    v128_t sums = wasm_i32x4_splat(0);
+
+    for (; i < block_end; i += 8) {
+      sums = wasm_i32x4_add(sums, wasm_i32x4_extadd_pairwise_i16x8(wasm_v128_load(values + i)));
+    }
+
+    std::int32_t lanes[4];
+    wasm_v128_store(lanes, sums);
+    for (int k = 0; k < 4; k++) {
+      total += lanes[k];
+    }
+  }
+
+  for (; i < count; i++) {
+    total += values[i];
+  }
+
+  return { static_cast<double>(total), count };
+}
+
+const reduce_kernels kernels{ &min_max_f32, &min_max_f64, &min_max_i16, &sum_f32, &sum_f64, &sum_i16 };
+
+} // namespace
+
+auto
+get_wasm_kernels() -> const reduce_kernels*
+{
+  return &kernels;
+}
+
+#else
+
+auto
+get_wasm_kernels() -> const reduce_kernels*
+{
+  return nullptr;
+}
+
+#endif
+
+} // namespace glow
@@ -0,0 +1,449 @@
+#include <glow/render_graph.hpp>
+
+#include <glow/gl_state.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace glow {
+
+render_graph::render_graph(framebuffer_pool& pool)
+  : pool_(&pool)
+{
+}
+
+render_graph::~render_graph() = default;
+
+auto
+render_graph::create_target(const char* name,
+                            const GLsizei width,
+                            const GLsizei height,
+                            const framebuffer_format& format) -> resource
+{
+  target_info info;
+  info.name = name;
+  info.width = width;
+  info.height = height;
+  info.format = format;
+  targets_.emplace_back(std::move(info));
+  compiled_ = false;
+  return targets_.size() - 1;
+}
+
+auto
+render_graph::import_target(const char* name, framebuffer& target) -> resource
+{
+  target_info info;
+  info.name = name;
+  info.width = target.width();
+  info.height = target.height();
+  info.format = target.format();
+  info.imported = &target;
+  targets_.emplace_back(std::move(info));
+  compiled_ = false;
+  return targets_.size() - 1;
+}
+
+auto
+render_graph::import_default_framebuffer(const char* name, const GLsizei width, const GLsizei height) -> resource
+{
+  target_info info;
+  info.name = name;
+  info.width = width;
+  info.height = height;
+  info.is_default_framebuffer = true;
+  targets_.emplace_back(std::move(info));
+  compiled_ = false;
+  return targets_.size() - 1;
+}
+
+void
+render_graph::add_pass(const char* name,
+                       const std::function<void(builder&)>& setup,
+                       std::function<void(context&)> execute)
+{
+  pass_info info;
+  info.name = name;
+  info.execute = std::move(execute);
+  passes_.emplace_back(std::move(info));
+
+  builder b(*this, passes_.size() - 1);
+
+  if (setup) {
+    setup(b);
+  }
+
+  compiled_ = false;
+}
+
+auto
+render_graph::is_transient(const resource r) const -> bool
+{
+  const auto& t = targets_.at(r);
+  return !t.imported && !t.is_default_framebuffer;
+}
+
+void
+render_graph::compile()
+{
+  const auto num_passes = passes_.size();
+
+  // Build the dependency edges, all of which point to earlier passes. A read depends on the most recent earlier pass
+  // that writes the target, and a write depends on every earlier pass that reads or writes the target, so that it does
+  // not overwrite the target before they are done with it. Only the edges of reads keep a pass from being culled, since
+  // the other edges only order the passes.
+
+  std::vector<std::vector<std::size_t>> dependencies(num_passes);
+
+  std::vector<std::vector<std::size_t>> producers(num_passes);
+
+  const auto uses = [](const std::vector<resource>& list, const resource r) -> bool {
+    return std::find(list.begin(), list.end(), r) != list.end();
+  };
+
+  const auto add_edge = [](std::vector<std::size_t>& edges, const std::size_t j) {
+    if (std::find(edges.begin(), edges.end(), j) == edges.end()) {
+      edges.emplace_back(j);
+    }
+  };
+
+  for (std::size_t i = 0; i < num_passes; i++) {
+
+    const auto& p = passes_[i];
+
+    for (const auto r : p.reads) {
+      for (auto j = i; j > 0; j--) {
+        if (uses(passes_[j - 1].writes, r)) {
+          add_edge(dependencies[i], j - 1);
+          add_edge(producers[i], j - 1);
+          break;
+        }
+      }
+    }
+
+    for (const auto r : p.writes) {
+      for (std::size_t j = 0; j < i; j++) {
+        if (uses(passes_[j].reads, r) || uses(passes_[j].writes, r)) {
+          add_edge(dependencies[i], j);
+        }
+      }
+    }
+  }
+
+  // Cull the passes that do not contribute to anything visible outside of the graph.
+
+  for (auto& p : passes_) {
+    p.active = p.side_effects;
+    for (const auto r : p.writes) {
+      p.active = p.active || !is_transient(r);
+    }
+  }
+
+  std::vector<std::size_t> stack;
+
+  for (std::size_t i = 0; i < num_passes; i++) {
+    if (passes_[i].active) {
+      stack.emplace_back(i);
+    }
+  }
+
+  while (!stack.empty()) {
+    const auto i = stack.back();
+    stack.pop_back();
+    for (const auto j : producers[i]) {
+      if (!passes_[j].active) {
+        passes_[j].active = true;
+        stack.emplace_back(j);
+      }
+    }
+  }
+
+  // Order the remaining passes, preferring the order in which they were added when there is a choice.
+
+  std::vector<std::size_t> pending(num_passes, 0);
+
+  // Edges to culled passes are dropped, since those passes are never scheduled.
+  for (std::size_t i = 0; i < num_passes; i++) {
+    const auto& deps = dependencies[i];
+    pending[i] = static_cast<std::size_t>(
+      std::count_if(deps.begin(), deps.end(), [this](const std::size_t j) { return passes_[j].active; }));
+  }
+
+  std::vector<bool> scheduled(num_passes, false);
+
+  order_.clear();
+
+  for (;;) {
+
+    std::size_t next{ num_passes };
+
+    for (std::size_t i = 0; i < num_passes; i++) {
+      if (passes_[i].active && !scheduled[i] && (pending[i] == 0)) {
+        next = i;
+        break;
+      }
+    }
+
+    if (next == num_passes) {
+      break;
+    }
+
+    scheduled[next] = true;
+
+    order_.emplace_back(next);
+
+    for (std::size_t i = 0; i < num_passes; i++) {
+      const auto& deps = dependencies[i];
+      pending[i] -= static_cast<std::size_t>(std::count(deps.begin(), deps.end(), next));
+    }
+  }
+
+  if (order_.size() != active_pass_count()) {
+    throw std::runtime_error("Render graph contains a dependency cycle.");
+  }
+
+  // Find the lifetime of each transient target, in terms of the executed pass order.
+
+  constexpr auto unused = static_cast<std::size_t>(-1);
+
+  std::vector<std::size_t> first_use(targets_.size(), unused);
+  std::vector<std::size_t> last_use(targets_.size(), unused);
+
+  for (std::size_t i = 0; i < order_.size(); i++) {
+
+    const auto& p = passes_[order_[i]];
+
+    const auto touch = [&](const resource r) {
+      if (first_use[r] == unused) {
+        first_use[r] = i;
+      }
+      last_use[r] = i;
+    };
+
+    std::for_each(p.reads.begin(), p.reads.end(), touch);
+    std::for_each(p.writes.begin(), p.writes.end(), touch);
+  }
+
+  // Assign transient targets to physical framebuffers. A framebuffer can be shared by targets with matching
+  // descriptors, as long as their lifetimes do not overlap.
+
+  std::vector<resource> transients;
+
+  for (resource r = 0; r < targets_.size(); r++) {
+    targets_[r].live = is_transient(r) && (first_use[r] != unused);
+    if (targets_[r].live) {
+      transients.emplace_back(r);
+    }
+  }
+
+  std::sort(transients.begin(), transients.end(), [&first_use](const resource a, const resource b) {
+    return first_use[a] < first_use[b];
+  });
+
+  for (auto& pt : physical_targets_) {
+    if (pt.target) {
+      pool_->release(*pt.target);
+    }
+  }
+
+  physical_targets_.clear();
+
+  std::vector<std::size_t> busy_until;
+
+  for (const auto r : transients) {
+
+    auto& t = targets_[r];
+
+    std::size_t index{ physical_targets_.size() };
+
+    for (std::size_t i = 0; i < physical_targets_.size(); i++) {
+      const auto& pt = physical_targets_[i];
+      if ((busy_until[i] < first_use[r]) && (pt.width == t.width) && (pt.height == t.height) &&
+          (pt.format == t.format)) {
+        index = i;
+        break;
+      }
+    }
+
+    if (index == physical_targets_.size()) {
+      physical_target pt;
+      pt.width = t.width;
+      pt.height = t.height;
+      pt.format = t.format;
+      physical_targets_.emplace_back(pt);
+      busy_until.emplace_back(0);
+    }
+
+    busy_until[index] = last_use[r];
+
+    t.physical_index = index;
+  }
+
+  compiled_ = true;
+}
+
+void
+render_graph::execute()
+{
+  if (!compiled_) {
+    compile();
+  }
+
+  for (auto& pt : physical_targets_) {
+    pt.target = &pool_->acquire(pt.width, pt.height, pt.format);
+  }
+
+  context ctx(*this);
+
+  for (const auto i : order_) {
+    auto& p = passes_[i];
+    if (p.execute) {
+      p.execute(ctx);
+    }
+  }
+
+  for (auto& pt : physical_targets_) {
+    pool_->release(*pt.target);
+    pt.target = nullptr;
+  }
+
+  gl_state::current().bind_framebuffer(GL_FRAMEBUFFER, 0);
+}
+
+void
+render_graph::reset()
+{
+  targets_.clear();
+  passes_.clear();
+  order_.clear();
+  physical_targets_.clear();
+  compiled_ = false;
+}
+
+auto
+render_graph::active_pass_count() const -> std::size_t
+{
+  return static_cast<std::size_t>(
+    std::count_if(passes_.begin(), passes_.end(), [](const pass_info& p) { return p.active; }));
+}
+
+auto
+render_graph::culled_pass_count() const -> std::size_t
+{
+  return passes_.size() - active_pass_count();
+}
+
+auto
+render_graph::physical_target_count() const -> std::size_t
+{
+  return physical_targets_.size();
+}
+
+auto
+render_graph::transient_memory_usage() const -> std::size_t
+{
+  std::size_t total{};
+
+  for (const auto& pt : physical_targets_) {
+    total += static_cast<std::size_t>(pt.width) * static_cast<std::size_t>(pt.height) * pt.format.texel_size();
+  }
+
+  return total;
+}
+
+auto
+render_graph::unaliased_memory_usage() const -> std::size_t
+{
+  std::size_t total{};
+
+  for (resource r = 0; r < targets_.size(); r++) {
+    // Targets that are never used, or that are only used by culled passes, would not be allocated either way.
+    if (targets_[r].live) {
+      const auto& t = targets_[r];
+      total += static_cast<std::size_t>(t.width) * static_cast<std::size_t>(t.height) * t.format.texel_size();
+    }
+  }
+
+  return total;
+}
+
+render_graph::builder::builder(render_graph& graph, const std::size_t pass)
+  : graph_(&graph)
+  , pass_(pass)
+{
+}
+
+void
+render_graph::builder::read(const resource r)
+{
+  graph_->passes_.at(pass_).reads.emplace_back(r);
+}
+
+void
+render_graph::builder::write(const resource r)
+{
+  graph_->passes_.at(pass_).writes.emplace_back(r);
+}
+
+void
+render_graph::builder::set_side_effects(const bool enabled)
+{
+  graph_->passes_.at(pass_).side_effects = enabled;
+}
+
+render_graph::context::context(render_graph& graph)
+  : graph_(&graph)
+{
+}
+
+void
+render_graph::context::bind(const resource r)
+{
+  auto& t = graph_->targets_.at(r);
+
+  if (t.is_default_framebuffer) {
+    gl_state::current().bind_framebuffer(GL_FRAMEBUFFER, 0);
+  } else if (t.imported) {
+    t.imported->bind();
+  } else {
+    graph_->physical_targets_.at(t.physical_index).target->bind();
+  }
+
+  gl_state::current().viewport(0, 0, t.width, t.height);
+}
+
+auto
+render_graph::context::texture(const resource r) -> GLuint
+{
+  auto& t = graph_->targets_.at(r);
+
+  if (t.is_default_framebuffer) {
+    return 0;
+  }
+
+  if (t.imported) {
+    return t.imported->color_attachment();
+  }
+
+  return graph_->physical_targets_.at(t.physical_index).target->color_attachment();
+}
+
+auto
+render_graph::context::width(const resource r) const -> GLsizei
+{
+  return graph_->targets_.at(r).width;
+}
+
+auto
+render_graph::context::height(const resource r) const -> GLsizei
+{
+  return graph_->targets_.at(r).height;
+}
+
+auto
+render_graph::context::quad() -> screen_quad&
+{
+  return graph_->quad_;
+}
+
+} // namespace glow
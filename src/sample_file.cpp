@@ -0,0 +1,547 @@
+#include <glow/sample_file.hpp>
+
+#include <glow/reduce.hpp>
+
+#include "mapped_file.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+namespace glow {
+
+namespace {
+
+constexpr char sample_magic[8] = { 'G', 'L', 'O', 'W', 'S', 'M', 'P', '1' };
+
+constexpr char overview_magic[8] = { 'G', 'L', 'O', 'W', 'O', 'V', 'R', '1' };
+
+/// @brief The size of the headers of both the sample files and their overview indices.
+constexpr std::size_t header_size{ 64 };
+
+/// @brief The number of samples covered by each entry of the finest level of the overview.
+constexpr std::uint64_t block_size{ 1024 };
+
+/// @brief The number of entries of each level that are covered by one entry of the level above it.
+constexpr std::uint64_t level_factor{ 16 };
+
+/// @brief The number of overview entries that are buffered for each level while the overview is being built.
+constexpr std::size_t write_batch{ 4096 };
+
+constexpr auto infinity = std::numeric_limits<double>::infinity();
+
+constexpr auto nan = std::numeric_limits<double>::quiet_NaN();
+
+struct overview_header final
+{
+  char magic[8];
+
+  std::uint32_t block_size;
+
+  std::uint32_t level_factor;
+
+  std::uint32_t level_count;
+
+  std::uint32_t channels;
+
+  std::uint64_t sample_count;
+
+  /// @brief The size of the sample file, so that an index is not used for a file that was replaced.
+  std::uint64_t file_size;
+
+  unsigned char reserved[24];
+};
+
+static_assert(sizeof(overview_header) == header_size, "The overview header must fill the space reserved for it.");
+
+template<typename T>
+auto
+read(const unsigned char* data, const std::size_t offset) -> T
+{
+  T value;
+  std::memcpy(&value, data + offset, sizeof(T));
+  return value;
+}
+
+auto
+type_size(const sample_type type) -> std::size_t
+{
+  switch (type) {
+    case sample_type::float32:
+      return 4;
+    case sample_type::float64:
+      return 8;
+    case sample_type::int16:
+      return 2;
+  }
+  return 0;
+}
+
+/// @brief Calls a function with a null pointer of the element type of a sample type.
+template<typename Func>
+void
+visit_type(const sample_type type, Func&& func)
+{
+  switch (type) {
+    case sample_type::float32:
+      func(static_cast<const float*>(nullptr));
+      break;
+    case sample_type::float64:
+      func(static_cast<const double*>(nullptr));
+      break;
+    case sample_type::int16:
+      func(static_cast<const std::int16_t*>(nullptr));
+      break;
+  }
+}
+
+/// @brief Merges the minimum and maximum of a run of samples into a range, skipping NaN.
+///
+/// @note The header is a multiple of every sample size, so the columns are suitably aligned to be read in place.
+template<typename T>
+void
+scan(const unsigned char* column, const std::uint64_t first, const std::uint64_t last, double& min, double& max)
+{
+  if (first >= last) {
+    return;
+  }
+
+  const auto r = reduce_min_max(reinterpret_cast<const T*>(column) + first, static_cast<std::size_t>(last - first));
+  min = (r.min < min) ? r.min : min;
+  max = (r.max > max) ? r.max : max;
+}
+
+} // namespace
+
+sample_file::sample_file(const std::string& path)
+  : file_(new mapped_file(path))
+{
+  const auto* data = file_->data();
+
+  if ((file_->size() < header_size) || (std::memcmp(data, sample_magic, sizeof(sample_magic)) != 0)) {
+    throw std::runtime_error("'" + path + "' is not a sample file.");
+  }
+
+  const auto type = read<std::uint32_t>(data, 8);
+  if (type > static_cast<std::uint32_t>(sample_type::int16)) {
+    throw std::runtime_error("'" + path + "' has an unknown sample type.");
+  }
+
+  type_ = static_cast<sample_type>(type);
+  channels_ = read<std::uint32_t>(data, 12);
+  size_ = read<std::uint64_t>(data, 16);
+  sample_rate_ = read<double>(data, 24);
+  start_time_ = read<double>(data, 32);
+
+  if ((channels_ == 0) || !(sample_rate_ > 0.0)) {
+    throw std::runtime_error("'" + path + "' has an invalid header.");
+  }
+
+  const auto column_capacity = (file_->size() - header_size) / (channels_ * type_size(type_));
+  if (size_ > column_capacity) {
+    throw std::runtime_error("'" + path + "' is shorter than its header says it is.");
+  }
+
+  if (size_ > 0) {
+    std::uint64_t span{ block_size };
+    for (;;) {
+      const auto entries = (size_ + span - 1) / span;
+      level_offsets_.push_back(entries_per_channel_);
+      entries_per_channel_ += entries;
+      if (entries == 1) {
+        break;
+      }
+      span *= level_factor;
+    }
+  }
+
+  views_.resize(channels_);
+
+  open_overview(path);
+}
+
+sample_file::~sample_file() = default;
+
+void
+sample_file::open_overview(const std::string& path)
+{
+  if (entries_per_channel_ == 0) {
+    return;
+  }
+
+  const auto overview_path = path + ".overview";
+
+  const auto entries_size = static_cast<std::size_t>(channels_ * entries_per_channel_ * sizeof(range));
+
+  overview_header header{};
+  std::memcpy(header.magic, overview_magic, sizeof(overview_magic));
+  header.block_size = static_cast<std::uint32_t>(block_size);
+  header.level_factor = static_cast<std::uint32_t>(level_factor);
+  header.level_count = static_cast<std::uint32_t>(level_offsets_.size());
+  header.channels = static_cast<std::uint32_t>(channels_);
+  header.sample_count = size_;
+  header.file_size = file_->size();
+
+  std::error_code data_ec;
+  std::error_code overview_ec;
+
+  const auto data_time = std::filesystem::last_write_time(path, data_ec);
+
+  const auto overview_time = std::filesystem::last_write_time(overview_path, overview_ec);
+
+  if (!data_ec && !overview_ec && (overview_time >= data_time)) {
+    try {
+      overview_file_.reset(new mapped_file(overview_path));
+      if ((overview_file_->size() == (header_size + entries_size)) &&
+          (std::memcmp(overview_file_->data(), &header, header_size) == 0)) {
+        overview_ = overview_file_->data() + header_size;
+        return;
+      }
+    } catch (const std::runtime_error&) {
+    }
+    overview_file_.reset();
+  }
+
+  // The index is written to a temporary file first, so that a crash cannot leave a truncated index behind.
+
+  const auto tmp_path = overview_path + ".tmp";
+
+  {
+    std::ofstream file(tmp_path, std::ios::binary);
+    if (file.good()) {
+      file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+      build_overview([&](const std::uint64_t offset, const range* entries, const std::size_t count) {
+        file.seekp(static_cast<std::streamoff>(header_size + offset * sizeof(range)));
+        file.write(reinterpret_cast<const char*>(entries), static_cast<std::streamsize>(count * sizeof(range)));
+      });
+    }
+
+    const auto written = file.good();
+
+    file.close();
+
+    bool renamed{ false };
+
+    if (written && file.good()) {
+      // The old index is removed first, since rename does not replace an existing file everywhere. It usually does not
+      // exist, so only the result of the rename is checked.
+      std::remove(overview_path.c_str());
+      renamed = (std::rename(tmp_path.c_str(), overview_path.c_str()) == 0);
+    }
+
+    if (renamed) {
+      try {
+        overview_file_.reset(new mapped_file(overview_path));
+        if ((overview_file_->size() == (header_size + entries_size)) &&
+            (std::memcmp(overview_file_->data(), &header, header_size) == 0)) {
+          overview_ = overview_file_->data() + header_size;
+          return;
+        }
+      } catch (const std::runtime_error&) {
+      }
+      overview_file_.reset();
+    } else {
+      std::remove(tmp_path.c_str());
+    }
+  }
+
+  // The directory is not writable (such as on read-only media), so the index only lives as long as this object.
+
+  overview_memory_.resize(entries_size);
+
+  build_overview([&](const std::uint64_t offset, const range* entries, const std::size_t count) {
+    std::memcpy(overview_memory_.data() + offset * sizeof(range), entries, count * sizeof(range));
+  });
+
+  overview_ = overview_memory_.data();
+}
+
+template<typename Write>
+void
+sample_file::build_overview(Write write) const
+{
+  struct level_state final
+  {
+    std::vector<range> pending;
+
+    std::uint64_t written{};
+
+    range current{ infinity, -infinity };
+
+    std::uint64_t children{};
+  };
+
+  const auto level_count = level_offsets_.size();
+
+  for (std::size_t channel = 0; channel < channels_; channel++) {
+
+    std::vector<level_state> levels(level_count);
+
+    const auto channel_offset = channel * entries_per_channel_;
+
+    auto flush = [&](const std::size_t l) {
+      auto& s = levels[l];
+      write(channel_offset + level_offsets_[l] + s.written, s.pending.data(), s.pending.size());
+      s.written += s.pending.size();
+      s.pending.clear();
+    };
+
+    // Adds a completed entry to a level, and merges it into the entry of the level above it.
+    auto push = [&](std::size_t l, range r) {
+      for (;;) {
+        levels[l].pending.push_back(r);
+        if (levels[l].pending.size() == write_batch) {
+          flush(l);
+        }
+        if ((l + 1) == level_count) {
+          return;
+        }
+        auto& above = levels[l + 1];
+        above.current.min = (r.min < above.current.min) ? r.min : above.current.min;
+        above.current.max = (r.max > above.current.max) ? r.max : above.current.max;
+        if (++above.children < level_factor) {
+          return;
+        }
+        r = above.current;
+        above.current = range{ infinity, -infinity };
+        above.children = 0;
+        l++;
+      }
+    };
+
+    const auto* col = column(channel);
+
+    visit_type(type_, [&](auto type) {
+      using T = std::remove_const_t<std::remove_pointer_t<decltype(type)>>;
+      for (std::uint64_t first = 0; first < size_; first += block_size) {
+        range r{ infinity, -infinity };
+        scan<T>(col, first, std::min(first + block_size, size_), r.min, r.max);
+        push(0, r);
+      }
+    });
+
+    // The last entry of each level may cover fewer entries than the others.
+    for (std::size_t l = 1; l < level_count; l++) {
+      if (levels[l].children > 0) {
+        const auto r = levels[l].current;
+        levels[l].current = range{ infinity, -infinity };
+        levels[l].children = 0;
+        push(l, r);
+      }
+    }
+
+    for (std::size_t l = 0; l < level_count; l++) {
+      flush(l);
+    }
+  }
+}
+
+auto
+sample_file::update_view(const std::size_t channel) -> const view_cache&
+{
+  if (channel >= channels_) {
+    throw std::out_of_range("Sample file channel index is out of range.");
+  }
+
+  auto& view = views_[channel];
+
+  const auto limits = ImPlot::GetPlotLimits();
+  const auto width = std::max(static_cast<int>(ImPlot::GetPlotSize().x), 1);
+
+  if (view.valid && (view.x_min == limits.X.Min) && (view.x_max == limits.X.Max) && (view.width == width)) {
+    return view;
+  }
+
+  view.x_min = limits.X.Min;
+  view.x_max = limits.X.Max;
+  view.width = width;
+  view.valid = true;
+  view.starts.clear();
+  view.ends.clear();
+  view.mins.clear();
+  view.maxs.clear();
+
+  const auto n = static_cast<double>(size_);
+
+  const auto lower = std::ceil((limits.X.Min - start_time_) * sample_rate_);
+  const auto upper = std::floor((limits.X.Max - start_time_) * sample_rate_) + 1.0;
+
+  if (!(lower < n) || !(upper > 0.0)) {
+    return view;
+  }
+
+  auto first = (lower > 0.0) ? static_cast<std::uint64_t>(lower) : 0;
+  auto last = (upper < n) ? static_cast<std::uint64_t>(upper) : size_;
+
+  // Include the samples just outside of the view, so that the line reaches its edges.
+  first = (first > 0) ? (first - 1) : first;
+  last = (last < size_) ? (last + 1) : last;
+
+  if (first >= last) {
+    return view;
+  }
+
+  auto time_at = [&](const std::uint64_t i) { return start_time_ + static_cast<double>(i) / sample_rate_; };
+
+  auto add_group = [&](const std::uint64_t group_first, const std::uint64_t group_last, const range& r) {
+    const auto is_gap = r.min > r.max;
+    view.starts.push_back(time_at(group_first));
+    view.ends.push_back(time_at(group_last - 1));
+    view.mins.push_back(is_gap ? nan : r.min);
+    view.maxs.push_back(is_gap ? nan : r.max);
+  };
+
+  const auto samples_per_pixel = static_cast<double>(last - first) / static_cast<double>(width);
+
+  if (samples_per_pixel < static_cast<double>(block_size)) {
+    // Only the samples in view are read, which pages in about as much of the file as there are pixels.
+    const auto group = std::max(static_cast<std::uint64_t>(samples_per_pixel), std::uint64_t{ 1 });
+    const auto* col = column(channel);
+    visit_type(type_, [&](auto type) {
+      using T = std::remove_const_t<std::remove_pointer_t<decltype(type)>>;
+      for (auto g = first; g < last; g += group) {
+        const auto g_last = std::min(g + group, last);
+        range r{ infinity, -infinity };
+        scan<T>(col, g, g_last, r.min, r.max);
+        add_group(g, g_last, r);
+      }
+    });
+    return view;
+  }
+
+  std::size_t l{ 0 };
+  std::uint64_t span{ block_size };
+  while (((l + 1) < level_offsets_.size()) && (static_cast<double>(span * level_factor) <= samples_per_pixel)) {
+    span *= level_factor;
+    l++;
+  }
+
+  // Past the top level, several entries are merged to keep to about one group per pixel.
+  const auto group = std::max(static_cast<std::uint64_t>(samples_per_pixel / static_cast<double>(span)),
+                              std::uint64_t{ 1 });
+
+  const auto* entries = level(channel, l);
+
+  const auto first_entry = first / span;
+  const auto last_entry = (last - 1) / span + 1;
+
+  for (auto e = first_entry; e < last_entry; e += group) {
+    const auto e_last = std::min(e + group, last_entry);
+    range r{ infinity, -infinity };
+    for (auto i = e; i < e_last; i++) {
+      r.min = (entries[i].min < r.min) ? entries[i].min : r.min;
+      r.max = (entries[i].max > r.max) ? entries[i].max : r.max;
+    }
+    add_group(e * span, std::min(e_last * span, size_), r);
+  }
+
+  return view;
+}
+
+void
+sample_file::plot_line(const char* label, const std::size_t channel, const ImPlotLineFlags flags)
+{
+  const auto& view = update_view(channel);
+
+  xs_.clear();
+  ys_.clear();
+
+  for (std::size_t i = 0; i < view.starts.size(); i++) {
+    xs_.push_back(view.starts[i]);
+    ys_.push_back(view.mins[i]);
+    if (view.maxs[i] != view.mins[i]) {
+      xs_.push_back(view.ends[i]);
+      ys_.push_back(view.maxs[i]);
+    }
+  }
+
+  ImPlot::PlotLine(label, xs_.data(), ys_.data(), static_cast<int>(xs_.size()), flags);
+}
+
+void
+sample_file::plot_envelope(const char* label, const std::size_t channel, const ImPlotShadedFlags flags)
+{
+  const auto& view = update_view(channel);
+
+  ImPlot::PlotShaded(
+    label, view.starts.data(), view.mins.data(), view.maxs.data(), static_cast<int>(view.starts.size()), flags);
+}
+
+auto
+sample_file::value(const std::size_t channel, const std::uint64_t index) const -> double
+{
+  if ((channel >= channels_) || (index >= size_)) {
+    throw std::out_of_range("Sample file index is out of range.");
+  }
+
+  double result{};
+
+  visit_type(type_, [&](auto type) {
+    using T = std::remove_const_t<std::remove_pointer_t<decltype(type)>>;
+    result = static_cast<double>(read<T>(column(channel), static_cast<std::size_t>(index * sizeof(T))));
+  });
+
+  return result;
+}
+
+auto
+sample_file::time_range() const -> std::pair<double, double>
+{
+  if (size_ == 0) {
+    return { start_time_, start_time_ };
+  }
+
+  return { start_time_, start_time_ + static_cast<double>(size_ - 1) / sample_rate_ };
+}
+
+auto
+sample_file::type() const -> sample_type
+{
+  return type_;
+}
+
+auto
+sample_file::channels() const -> std::size_t
+{
+  return channels_;
+}
+
+auto
+sample_file::size() const -> std::uint64_t
+{
+  return size_;
+}
+
+auto
+sample_file::sample_rate() const -> double
+{
+  return sample_rate_;
+}
+
+auto
+sample_file::start_time() const -> double
+{
+  return start_time_;
+}
+
+auto
+sample_file::column(const std::size_t channel) const -> const unsigned char*
+{
+  return file_->data() + header_size + static_cast<std::size_t>(channel * size_ * type_size(type_));
+}
+
+auto
+sample_file::level(const std::size_t channel, const std::size_t index) const -> const range*
+{
+  const auto offset = channel * entries_per_channel_ + level_offsets_[index];
+  return reinterpret_cast<const range*>(overview_) + offset;
+}
+
+} // namespace glow
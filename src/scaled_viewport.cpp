@@ -0,0 +1,256 @@
+#include <glow/scaled_viewport.hpp>
+
+#include <glow/gl_state.hpp>
+#include <glow/shader_compiler.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+#include <cstdint>
+
+namespace glow {
+
+namespace {
+
+const char* const upscale_shader = R"(
+in vec2 texcoord;
+
+out vec4 frag_color;
+
+uniform sampler2D source_texture;
+
+/* The fraction of the scene framebuffer that holds the rendered scene. */
+uniform vec2 uv_scale;
+
+uniform vec2 texel_size;
+
+uniform float sharpness;
+
+void
+main()
+{
+  vec2 uv = texcoord * uv_scale;
+
+  vec3 center = texture(source_texture, uv).rgb;
+
+#if SHARPEN
+  vec3 neighbors = texture(source_texture, uv + vec2(texel_size.x, 0.0)).rgb +
+                   texture(source_texture, uv - vec2(texel_size.x, 0.0)).rgb +
+                   texture(source_texture, uv + vec2(0.0, texel_size.y)).rgb +
+                   texture(source_texture, uv - vec2(0.0, texel_size.y)).rgb;
+
+  center = clamp(center + (center - neighbors * 0.25) * sharpness * 2.0, 0.0, 1.0);
+#endif
+
+  frag_color = vec4(center, 1.0);
+}
+)";
+
+auto
+to_texture_id(const GLuint id) -> ImTextureID
+{
+  return reinterpret_cast<ImTextureID>(static_cast<std::uintptr_t>(id));
+}
+
+} // namespace
+
+scaled_viewport::scaled_viewport(const scaled_viewport_config& cfg)
+{
+  set_config(cfg);
+}
+
+scaled_viewport::~scaled_viewport()
+{
+  gl_state::current().forget_program(program_);
+  glDeleteProgram(program_);
+}
+
+void
+scaled_viewport::set_config(const scaled_viewport_config& cfg)
+{
+  const bool rebuild_program = !program_ || (cfg.filter != config_.filter);
+
+  const bool rebuild_scene = cfg.depth != config_.depth;
+
+  config_ = cfg;
+
+  scale_ = std::clamp(scale_, config_.min_scale, config_.max_scale);
+
+  if (rebuild_scene) {
+    scene_.reset();
+  }
+
+  if (!rebuild_program) {
+    return;
+  }
+
+  gl_state::current().forget_program(program_);
+  glDeleteProgram(program_);
+
+  const char* sharpen = (config_.filter == upscale_filter::sharpen) ? "1" : "0";
+
+  program_ = compile_shader(
+    screen_quad::fullscreen_vertex_shader, upscale_shader, { { "SHARPEN", sharpen } }, shader_version::es_300);
+
+  source_location_ = glGetUniformLocation(program_, "source_texture");
+  uv_scale_location_ = glGetUniformLocation(program_, "uv_scale");
+  texel_size_location_ = glGetUniformLocation(program_, "texel_size");
+  sharpness_location_ = glGetUniformLocation(program_, "sharpness");
+}
+
+auto
+scaled_viewport::get_config() const -> const scaled_viewport_config&
+{
+  return config_;
+}
+
+auto
+scaled_viewport::begin(ImVec2 size) -> bool
+{
+  const auto avail = ImGui::GetContentRegionAvail();
+
+  if (size.x <= 0) {
+    size.x = avail.x;
+  }
+
+  if (size.y <= 0) {
+    size.y = avail.y;
+  }
+
+  const auto& io = ImGui::GetIO();
+
+  const auto panel_w = static_cast<GLsizei>(size.x * io.DisplayFramebufferScale.x);
+  const auto panel_h = static_cast<GLsizei>(size.y * io.DisplayFramebufferScale.y);
+
+  if ((panel_w <= 0) || (panel_h <= 0)) {
+    return false;
+  }
+
+  update_scale();
+
+  if ((panel_w != panel_width_) || (panel_h != panel_height_) || !scene_) {
+
+    // The scene framebuffer is allocated at the largest scale, so that changing the scale only changes the viewport.
+
+    framebuffer_format scene_format;
+    scene_format.mag_filter = GL_LINEAR;
+    scene_format.depth = config_.depth;
+
+    const auto max_w = std::max(static_cast<GLsizei>(std::ceil(panel_w * config_.max_scale)), 1);
+    const auto max_h = std::max(static_cast<GLsizei>(std::ceil(panel_h * config_.max_scale)), 1);
+
+    scene_ = std::make_unique<framebuffer>(max_w, max_h, scene_format);
+
+    display_ = std::make_unique<framebuffer>(panel_w, panel_h);
+
+    panel_width_ = panel_w;
+    panel_height_ = panel_h;
+  }
+
+  width_ = std::clamp(static_cast<GLsizei>(std::lround(panel_w * scale_)), 1, scene_->width());
+  height_ = std::clamp(static_cast<GLsizei>(std::lround(panel_h * scale_)), 1, scene_->height());
+
+  scene_->bind();
+
+  gl_state::current().viewport(0, 0, width_, height_);
+
+  timer_.begin();
+
+  return true;
+}
+
+void
+scaled_viewport::end()
+{
+  timer_.end();
+
+  display_->bind();
+
+  auto& state = gl_state::current();
+
+  state.viewport(0, 0, display_->width(), display_->height());
+
+  state.disable(GL_BLEND);
+  state.disable(GL_DEPTH_TEST);
+  state.disable(GL_SCISSOR_TEST);
+
+  state.use_program(program_);
+
+  state.bind_texture(0, GL_TEXTURE_2D, scene_->color_attachment());
+
+  glUniform1i(source_location_, 0);
+  glUniform2f(uv_scale_location_,
+              static_cast<float>(width_) / static_cast<float>(scene_->width()),
+              static_cast<float>(height_) / static_cast<float>(scene_->height()));
+  glUniform2f(texel_size_location_,
+              1.0f / static_cast<float>(scene_->width()),
+              1.0f / static_cast<float>(scene_->height()));
+  glUniform1f(sharpness_location_, config_.sharpness * (1.0f - scale_));
+
+  quad_.draw_triangle();
+
+  state.bind_framebuffer(GL_FRAMEBUFFER, 0);
+
+  const auto& io = ImGui::GetIO();
+
+  const ImVec2 size(static_cast<float>(panel_width_) / io.DisplayFramebufferScale.x,
+                    static_cast<float>(panel_height_) / io.DisplayFramebufferScale.y);
+
+  ImGui::Image(to_texture_id(display_->color_attachment()), size, ImVec2(0, 1), ImVec2(1, 0));
+}
+
+void
+scaled_viewport::update_scale()
+{
+  // Without timer queries, there is nothing that measures the scene alone (the frame time is held at the refresh
+  // interval by vsync), so the scale is left as it is.
+  if (!timer_.supported()) {
+    return;
+  }
+
+  // The results arrive a few frames late, so the scale is only adjusted once per measurement. Adjusting it every frame
+  // with the same measurement would overshoot.
+  if (!timer_.poll() || (timer_.elapsed_ms() < 0)) {
+    return;
+  }
+
+  frame_ms_ = timer_.elapsed_ms();
+
+  if (frame_ms_ <= 0) {
+    return;
+  }
+
+  // The cost of the scene is roughly proportional to the number of pixels, which goes with the square of the scale.
+
+  const auto ideal = scale_ * std::sqrt(config_.target_ms / frame_ms_);
+
+  scale_ += (ideal - scale_) * config_.adjust_rate;
+
+  scale_ = std::clamp(scale_, config_.min_scale, config_.max_scale);
+}
+
+auto
+scaled_viewport::width() const -> GLsizei
+{
+  return width_;
+}
+
+auto
+scaled_viewport::height() const -> GLsizei
+{
+  return height_;
+}
+
+auto
+scaled_viewport::scale() const -> float
+{
+  return scale_;
+}
+
+auto
+scaled_viewport::frame_ms() const -> float
+{
+  return frame_ms_;
+}
+
+} // namespace glow
@@ -1,7 +1,21 @@
 #include <glow/screen_quad.hpp>
 
+#include <glow/gl_state.hpp>
+
 namespace glow {
 
+const char* const screen_quad::fullscreen_vertex_shader = R"(
+out vec2 texcoord;
+
+void
+main()
+{
+  vec2 p = vec2(float((gl_VertexID << 1) & 2), float(gl_VertexID & 2));
+  texcoord = p;
+  gl_Position = vec4(p * 2.0 - 1.0, 0.0, 1.0);
+}
+)";
+
 screen_quad::screen_quad()
 {
   const float vertices[] = {
@@ -15,23 +29,39 @@ screen_quad::screen_quad()
     // clang-format on
   };
 
+  auto& state = gl_state::current();
+
   glGenBuffers(1, &buffer_);
 
-  glBindBuffer(GL_ARRAY_BUFFER, buffer_);
+  state.bind_buffer(GL_ARRAY_BUFFER, buffer_);
 
   glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
 
   glGenVertexArrays(1, &vertex_array_);
 
-  glBindVertexArray(vertex_array_);
+  state.bind_vertex_array(vertex_array_);
 
-  glEnableVertexAttribArray(0);
+  glEnableVertexAttribArray(position_attrib_);
 
-  glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(float) * 2, reinterpret_cast<const void*>(0));
+  glVertexAttribPointer(position_attrib_, 2, GL_FLOAT, GL_FALSE, sizeof(float) * 2, reinterpret_cast<const void*>(0));
+
+  glGenVertexArrays(1, &empty_vertex_array_);
+
+  state.bind_vertex_array(0);
 }
 
 screen_quad::~screen_quad()
 {
+  auto& state = gl_state::current();
+
+  state.forget_vertex_array(empty_vertex_array_);
+
+  state.forget_vertex_array(vertex_array_);
+
+  state.forget_buffer(buffer_);
+
+  glDeleteVertexArrays(1, &empty_vertex_array_);
+
   glDeleteVertexArrays(1, &vertex_array_);
 
   glDeleteBuffers(1, &buffer_);
@@ -40,9 +70,32 @@ screen_quad::~screen_quad()
 void
 screen_quad::draw(GLint position_attrib)
 {
-  glBindVertexArray(vertex_array_);
+  auto& state = gl_state::current();
+
+  state.bind_vertex_array(vertex_array_);
+
+  if ((position_attrib >= 0) && (position_attrib != position_attrib_)) {
+
+    state.bind_buffer(GL_ARRAY_BUFFER, buffer_);
+
+    glDisableVertexAttribArray(position_attrib_);
+
+    glEnableVertexAttribArray(position_attrib);
+
+    glVertexAttribPointer(position_attrib, 2, GL_FLOAT, GL_FALSE, sizeof(float) * 2, reinterpret_cast<const void*>(0));
+
+    position_attrib_ = position_attrib;
+  }
 
   glDrawArrays(GL_TRIANGLES, 0, 6);
 }
 
+void
+screen_quad::draw_triangle()
+{
+  gl_state::current().bind_vertex_array(empty_vertex_array_);
+
+  glDrawArrays(GL_TRIANGLES, 0, 3);
+}
+
 } // namespace glow
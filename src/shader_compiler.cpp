@@ -1,9 +1,24 @@
 #include <glow/shader_compiler.hpp>
 
+#include "gl_extensions.h"
+
+#include <fstream>
+#include <iomanip>
+#include <iterator>
 #include <sstream>
 
+#include <cstdint>
+#include <cstdio>
 #include <cstring>
 
+#ifndef GLOW_VERSION
+#define GLOW_VERSION "unknown"
+#endif
+
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+
 namespace glow {
 
 shader_compile_error::shader_compile_error(const std::string& what, const std::string& source)
@@ -20,11 +35,164 @@ shader_compile_error::get_source() const -> const std::string&
 
 namespace {
 
+std::string shader_cache_directory;
+
+/// @brief The bytes at the start of every cache entry, which also act as the file format version.
+constexpr char cache_magic[8] = { 'G', 'L', 'O', 'W', 'P', 'B', '0', '1' };
+
+class fnv1a final
+{
+public:
+  void update(const void* data, const std::size_t size)
+  {
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    for (std::size_t i = 0; i < size; i++) {
+      m_state = (m_state ^ bytes[i]) * 1099511628211ULL;
+    }
+  }
+
+  void update(const char* str)
+  {
+    // The terminator is included, so that adjacent strings cannot be shifted into each other.
+    update(str ? str : "", str ? (std::strlen(str) + 1) : 1);
+  }
+
+  auto digest() const -> std::uint64_t { return m_state; }
+
+private:
+  std::uint64_t m_state{ 14695981039346656037ULL };
+};
+
 auto
-format(const std::vector<std::pair<std::string, std::string>>& defines) -> std::string
+cache_entry_path(const std::string& vert_source, const std::string& frag_source) -> std::string
 {
+  fnv1a hash;
+  hash.update(vert_source.c_str());
+  hash.update(frag_source.c_str());
+  hash.update(reinterpret_cast<const char*>(glGetString(GL_RENDERER)));
+  hash.update(reinterpret_cast<const char*>(glGetString(GL_VERSION)));
+  hash.update(GLOW_VERSION);
+
   std::ostringstream stream;
-  stream << "#version 100\n";
+  stream << shader_cache_directory << '/' << std::hex << std::setw(16) << std::setfill('0') << hash.digest() << ".bin";
+  return stream.str();
+}
+
+auto
+binary_cache_supported() -> bool
+{
+  if (shader_cache_directory.empty()) {
+    return false;
+  }
+
+  GLint num_formats{ 0 };
+
+  glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &num_formats);
+
+  return num_formats > 0;
+}
+
+/// @brief Attempts to create a program from a cache entry.
+///
+/// @return The ID of the program, or zero if there is no entry or the driver rejected it.
+auto
+load_cached_program(const std::string& path) -> GLuint
+{
+  std::ifstream file(path, std::ios::binary);
+  if (!file.good()) {
+    return 0;
+  }
+
+  char magic[sizeof(cache_magic)]{};
+  GLenum binary_format{};
+
+  file.read(magic, sizeof(magic));
+  file.read(reinterpret_cast<char*>(&binary_format), sizeof(binary_format));
+
+  if (!file.good() || (std::memcmp(magic, cache_magic, sizeof(magic)) != 0)) {
+    return 0;
+  }
+
+  const std::vector<char> binary((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+  GLuint id = glCreateProgram();
+
+  glProgramBinary(id, binary_format, binary.data(), static_cast<GLsizei>(binary.size()));
+
+  GLint link_status{ GL_FALSE };
+
+  glGetProgramiv(id, GL_LINK_STATUS, &link_status);
+
+  if (link_status == GL_TRUE) {
+    return id;
+  }
+
+  // Drivers reject binaries after updates, among other reasons. The entry is removed so it gets rebuilt from source.
+
+  glDeleteProgram(id);
+
+  file.close();
+
+  std::remove(path.c_str());
+
+  return 0;
+}
+
+void
+store_cached_program(const GLuint id, const std::string& path)
+{
+  GLint length{ 0 };
+
+  glGetProgramiv(id, GL_PROGRAM_BINARY_LENGTH, &length);
+
+  if (length <= 0) {
+    return;
+  }
+
+  std::vector<char> binary(static_cast<std::size_t>(length));
+
+  GLsizei read_size{ 0 };
+
+  GLenum binary_format{};
+
+  glGetProgramBinary(id, length, &read_size, &binary_format, binary.data());
+
+  // The entry is written to a temporary file first, so that a crash cannot leave a truncated entry behind.
+
+  const auto tmp_path = path + ".tmp";
+
+  {
+    std::ofstream file(tmp_path, std::ios::binary);
+    if (!file.good()) {
+      return;
+    }
+    file.write(cache_magic, sizeof(cache_magic));
+    file.write(reinterpret_cast<const char*>(&binary_format), sizeof(binary_format));
+    file.write(binary.data(), read_size);
+    if (!file.good()) {
+      file.close();
+      std::remove(tmp_path.c_str());
+      return;
+    }
+  }
+
+  std::remove(path.c_str());
+
+  std::rename(tmp_path.c_str(), path.c_str());
+}
+
+auto
+format(const std::vector<std::pair<std::string, std::string>>& defines, const shader_version version) -> std::string
+{
+  std::ostringstream stream;
+  switch (version) {
+    case shader_version::es_100:
+      stream << "#version 100\n";
+      break;
+    case shader_version::es_300:
+      stream << "#version 300 es\n";
+      break;
+  }
   for (const auto& def : defines) {
     stream << "#define " << def.first << ' ' << def.second << '\n';
   }
@@ -32,25 +200,64 @@ format(const std::vector<std::pair<std::string, std::string>>& defines) -> std::
   return stream.str();
 }
 
+/// @brief Appends the source of a shader to its prelude.
+///
+/// @details For GLSL ES 3.00, a default float precision is added as well. Since @c #extension directives must come
+///          before any statement, it is placed after the blank lines, line comments and @c #extension directives at the
+///          start of the source, with a @c #line directive so that errors still refer to the right lines.
 auto
-compile_single_shader(const char* source, GLenum type) -> GLuint
+with_prelude(const std::string& prelude, const std::string& source, const shader_version version) -> std::string
 {
-  GLuint id = glCreateShader(type);
+  if (version != shader_version::es_300) {
+    return prelude + source;
+  }
 
-  const GLint size = std::strlen(source);
+  std::size_t offset{ 0 };
 
-  glShaderSource(id, 1, &source, &size);
+  std::size_t lines{ 0 };
 
-  glCompileShader(id);
+  while (offset < source.size()) {
 
-  GLint status{ GL_COMPILE_STATUS };
+    auto end = source.find('\n', offset);
+    end = (end == std::string::npos) ? source.size() : (end + 1);
 
-  glGetShaderiv(id, GL_COMPILE_STATUS, &status);
+    const auto first = source.find_first_not_of(" \t\r\n", offset);
 
-  if (status == GL_TRUE) {
-    return id;
+    const auto is_blank = (first == std::string::npos) || (first >= end);
+
+    if (!is_blank && (source.compare(first, 2, "//") != 0) && (source.compare(first, 10, "#extension") != 0)) {
+      break;
+    }
+
+    offset = end;
+    lines++;
   }
 
+  const auto* separator = ((offset > 0) && (source[offset - 1] != '\n')) ? "\n" : "";
+
+  return prelude + source.substr(0, offset) + separator + "precision highp float;\n#line " + std::to_string(lines + 1) +
+         "\n" + source.substr(offset);
+}
+
+auto
+start_shader(const std::string& source, const GLenum type) -> GLuint
+{
+  GLuint id = glCreateShader(type);
+
+  const char* source_ptr = source.c_str();
+
+  const auto size = static_cast<GLint>(source.size());
+
+  glShaderSource(id, 1, &source_ptr, &size);
+
+  glCompileShader(id);
+
+  return id;
+}
+
+auto
+shader_log(const GLuint id) -> std::string
+{
   GLint log_length{ 0 };
 
   glGetShaderiv(id, GL_INFO_LOG_LENGTH, &log_length);
@@ -65,72 +272,276 @@ compile_single_shader(const char* source, GLenum type) -> GLuint
 
   log.resize(read_size);
 
-  glDeleteShader(id);
+  return log;
+}
 
-  throw shader_compile_error(log, source);
+auto
+program_log(const GLuint id) -> std::string
+{
+  GLint log_length{ 0 };
+
+  glGetProgramiv(id, GL_INFO_LOG_LENGTH, &log_length);
+
+  GLsizei read_size{ 0 };
+
+  std::string log;
+
+  log.resize(log_length);
+
+  glGetProgramInfoLog(id, log_length, &read_size, &log[0]);
+
+  log.resize(read_size);
+
+  return log;
+}
+
+auto
+shader_compiled(const GLuint id) -> bool
+{
+  GLint status{ GL_FALSE };
+
+  glGetShaderiv(id, GL_COMPILE_STATUS, &status);
+
+  return status == GL_TRUE;
 }
 
 } // namespace
 
-GLuint
-compile_shader(const char* vert_source_in,
-               const char* frag_source_in,
-               const std::vector<std::pair<std::string, std::string>>& defines)
+shader_job::shader_job(shader_job&& other) noexcept
 {
-  const auto defs = format(defines);
+  *this = std::move(other);
+}
 
-  const std::string vert_source = defs + vert_source_in;
-  const std::string frag_source = defs + frag_source_in;
+auto
+shader_job::operator=(shader_job&& other) noexcept -> shader_job&
+{
+  if (this == &other) {
+    return *this;
+  }
 
-  GLuint vert_id = compile_single_shader(vert_source.c_str(), GL_VERTEX_SHADER);
+  release();
+
+  vert_id_ = other.vert_id_;
+  frag_id_ = other.frag_id_;
+  program_id_ = other.program_id_;
+  vert_source_ = std::move(other.vert_source_);
+  frag_source_ = std::move(other.frag_source_);
+  cache_path_ = std::move(other.cache_path_);
+  error_ = std::move(other.error_);
+  parallel_ = other.parallel_;
+  done_ = other.done_;
+  taken_ = other.taken_;
+  poll_count_ = other.poll_count_;
+
+  other.vert_id_ = 0;
+  other.frag_id_ = 0;
+  other.program_id_ = 0;
+
+  return *this;
+}
 
-  GLuint frag_id{ 0 };
+shader_job::~shader_job()
+{
+  release();
+}
 
-  try {
-    frag_id = compile_single_shader(frag_source.c_str(), GL_FRAGMENT_SHADER);
-  } catch (const shader_compile_error& e) {
-    glDeleteShader(vert_id);
-    throw e;
+void
+shader_job::release()
+{
+  if (vert_id_) {
+    glDeleteShader(vert_id_);
+    vert_id_ = 0;
   }
 
-  GLuint id = glCreateProgram();
+  if (frag_id_) {
+    glDeleteShader(frag_id_);
+    frag_id_ = 0;
+  }
+
+  if (program_id_ && !taken_) {
+    glDeleteProgram(program_id_);
+  }
+
+  program_id_ = 0;
+}
+
+auto
+shader_job::poll() -> bool
+{
+  if (done_) {
+    return true;
+  }
+
+  poll_count_++;
+
+  if (parallel_) {
+
+    GLint complete{ GL_FALSE };
+
+    glGetProgramiv(program_id_, GL_COMPLETION_STATUS_KHR, &complete);
+
+    if (complete == GL_FALSE) {
+      return false;
+    }
+
+  } else if (poll_count_ < 2) {
+    return false;
+  }
+
+  finish();
+
+  return true;
+}
+
+auto
+shader_job::done() const -> bool
+{
+  return done_;
+}
+
+auto
+shader_job::get() -> GLuint
+{
+  if (!done_) {
+    finish();
+  }
+
+  if (error_) {
+    std::rethrow_exception(error_);
+  }
 
-  glAttachShader(id, vert_id);
-  glAttachShader(id, frag_id);
+  taken_ = true;
 
-  glLinkProgram(id);
+  return program_id_;
+}
 
-  glDetachShader(id, vert_id);
-  glDetachShader(id, frag_id);
+void
+shader_job::finish()
+{
+  done_ = true;
 
-  glDeleteShader(vert_id);
-  glDeleteShader(frag_id);
+  if (!program_id_) {
+    return;
+  }
 
   GLint link_status{ GL_FALSE };
 
-  glGetProgramiv(id, GL_LINK_STATUS, &link_status);
+  glGetProgramiv(program_id_, GL_LINK_STATUS, &link_status);
 
   if (link_status == GL_TRUE) {
-    return id;
+
+    if (!cache_path_.empty()) {
+      store_cached_program(program_id_, cache_path_);
+    }
+
+  } else if (!shader_compiled(vert_id_)) {
+    error_ = std::make_exception_ptr(shader_compile_error(shader_log(vert_id_), vert_source_));
+  } else if (!shader_compiled(frag_id_)) {
+    error_ = std::make_exception_ptr(shader_compile_error(shader_log(frag_id_), frag_source_));
+  } else {
+    error_ = std::make_exception_ptr(shader_link_error(program_log(program_id_)));
   }
 
-  GLint log_length{ 0 };
+  glDetachShader(program_id_, vert_id_);
+  glDetachShader(program_id_, frag_id_);
 
-  glGetProgramiv(id, GL_INFO_LOG_LENGTH, &log_length);
+  glDeleteShader(vert_id_);
+  glDeleteShader(frag_id_);
 
-  GLsizei read_size{ 0 };
+  vert_id_ = 0;
+  frag_id_ = 0;
 
-  std::string log;
+  if (error_) {
+    glDeleteProgram(program_id_);
+    program_id_ = 0;
+  }
 
-  log.resize(log_length);
+  vert_source_.clear();
+  frag_source_.clear();
+}
 
-  glGetProgramInfoLog(id, log_length, &read_size, &log[0]);
+auto
+compile_shader_async(const char* vert_source_in,
+                     const char* frag_source_in,
+                     const std::vector<std::pair<std::string, std::string>>& defines,
+                     const shader_version version) -> shader_job
+{
+  const auto defs = format(defines, version);
 
-  log.resize(read_size);
+  shader_job job;
 
-  glDeleteProgram(id);
+  job.vert_source_ = with_prelude(defs, vert_source_in, version);
+  job.frag_source_ = with_prelude(defs, frag_source_in, version);
+
+  const bool use_cache = binary_cache_supported();
+
+  if (use_cache) {
+
+    job.cache_path_ = cache_entry_path(job.vert_source_, job.frag_source_);
+
+    const auto cached_id = load_cached_program(job.cache_path_);
+    if (cached_id != 0) {
+      job.program_id_ = cached_id;
+      job.done_ = true;
+      return job;
+    }
+  }
+
+  job.parallel_ = has_gl_extension("GL_KHR_parallel_shader_compile");
+
+  // Both shaders are compiled and the program is linked without checking any status in between, since each status
+  // query forces the driver to finish the work synchronously. Errors are sorted out once the link has completed.
+
+  job.vert_id_ = start_shader(job.vert_source_, GL_VERTEX_SHADER);
+  job.frag_id_ = start_shader(job.frag_source_, GL_FRAGMENT_SHADER);
 
-  throw shader_link_error(log);
+  job.program_id_ = glCreateProgram();
+
+  glAttachShader(job.program_id_, job.vert_id_);
+  glAttachShader(job.program_id_, job.frag_id_);
+
+  if (use_cache) {
+    glProgramParameteri(job.program_id_, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+  }
+
+  glLinkProgram(job.program_id_);
+
+  return job;
+}
+
+GLuint
+compile_shader(const char* vert_source_in,
+               const char* frag_source_in,
+               const std::vector<std::pair<std::string, std::string>>& defines,
+               const shader_version version)
+{
+  return compile_shader_async(vert_source_in, frag_source_in, defines, version).get();
+}
+
+auto
+bind_uniform_block(const GLuint program, const char* block_name, const GLuint binding) -> bool
+{
+  const auto index = glGetUniformBlockIndex(program, block_name);
+
+  if (index == GL_INVALID_INDEX) {
+    return false;
+  }
+
+  glUniformBlockBinding(program, index, binding);
+
+  return true;
+}
+
+void
+set_shader_cache_directory(const std::string& path)
+{
+  shader_cache_directory = path;
+}
+
+auto
+get_shader_cache_directory() -> const std::string&
+{
+  return shader_cache_directory;
 }
 
 } // namespace glow
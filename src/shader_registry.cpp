@@ -0,0 +1,392 @@
+#include <glow/shader_registry.hpp>
+
+#include <glow/gl_state.hpp>
+
+#include <imgui.h>
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+#else
+#include <filesystem>
+#include <system_error>
+#endif
+
+namespace glow {
+
+namespace {
+
+auto
+read_file(const std::string& path, std::string& content) -> bool
+{
+  std::ifstream file(path, std::ios::binary);
+  if (!file.good()) {
+    return false;
+  }
+
+  std::ostringstream stream;
+  stream << file.rdbuf();
+  content = stream.str();
+  return true;
+}
+
+} // namespace
+
+#ifdef __linux__
+
+/// @brief Watches the directories that contain the shader files.
+///
+/// @details Directories are watched instead of the files themselves, since many editors save by writing a new file and
+///          renaming it over the old one, which would orphan a watch on the file.
+class shader_registry::watcher final
+{
+public:
+  watcher()
+    : m_fd(inotify_init1(IN_NONBLOCK | IN_CLOEXEC))
+  {
+  }
+
+  ~watcher()
+  {
+    if (m_fd >= 0) {
+      close(m_fd);
+    }
+  }
+
+  watcher(const watcher&) = delete;
+
+  watcher(watcher&&) = delete;
+
+  auto operator=(const watcher&) -> watcher& = delete;
+
+  auto operator=(watcher&&) -> watcher& = delete;
+
+  void add(const std::string& path)
+  {
+    if (m_fd < 0) {
+      return;
+    }
+
+    const auto dir = directory_of(path);
+
+    for (auto& w : m_watches) {
+      if (w.dir == dir) {
+        if (std::find(w.files.begin(), w.files.end(), path) == w.files.end()) {
+          w.files.emplace_back(path);
+        }
+        return;
+      }
+    }
+
+    // In-place saves end with IN_CLOSE_WRITE and atomic saves with IN_MOVED_TO. IN_CREATE is left out, since it fires
+    // before the new file has any content.
+    const int wd = inotify_add_watch(m_fd, dir.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+    if (wd >= 0) {
+      m_watches.emplace_back(watch{ wd, dir, { path } });
+    }
+  }
+
+  /// @brief Reads the pending events and calls the callback with the path of each changed file.
+  ///
+  /// @details Events are matched by the watch descriptor and the bare file name, and the callback receives the path
+  ///          exactly as it was passed to @ref add, so that it compares equal no matter how the path was spelled.
+  template<typename Callback>
+  void poll(Callback cb)
+  {
+    if (m_fd < 0) {
+      return;
+    }
+
+    alignas(inotify_event) char buffer[4096];
+
+    for (;;) {
+
+      const auto size = read(m_fd, buffer, sizeof(buffer));
+      if (size <= 0) {
+        break;
+      }
+
+      for (ssize_t offset = 0; offset < size;) {
+
+        const auto* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+
+        offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+
+        if (event->len == 0) {
+          continue;
+        }
+
+        for (const auto& w : m_watches) {
+          if (w.wd != event->wd) {
+            continue;
+          }
+          for (const auto& f : w.files) {
+            if (file_name_of(f) == event->name) {
+              cb(f);
+            }
+          }
+        }
+      }
+    }
+  }
+
+private:
+  static auto directory_of(const std::string& path) -> std::string
+  {
+    const auto pos = path.find_last_of('/');
+    return (pos == std::string::npos) ? std::string(".") : path.substr(0, pos);
+  }
+
+  static auto file_name_of(const std::string& path) -> std::string
+  {
+    const auto pos = path.find_last_of('/');
+    return (pos == std::string::npos) ? path : path.substr(pos + 1);
+  }
+
+  struct watch final
+  {
+    int wd{ -1 };
+
+    std::string dir;
+
+    /// @brief The paths of the files in the directory, as they were passed to @ref add.
+    std::vector<std::string> files;
+  };
+
+  int m_fd{ -1 };
+
+  std::vector<watch> m_watches;
+};
+
+#else
+
+/// @brief Compares the modification times of the shader files against the last time they were checked.
+class shader_registry::watcher final
+{
+public:
+  void add(const std::string& path) { m_files.emplace_back(path, modification_time(path)); }
+
+  template<typename Callback>
+  void poll(Callback cb)
+  {
+    for (auto& f : m_files) {
+      const auto t = modification_time(f.first);
+      if (t != f.second) {
+        f.second = t;
+        cb(f.first);
+      }
+    }
+  }
+
+private:
+  static auto modification_time(const std::string& path) -> std::filesystem::file_time_type
+  {
+    std::error_code ec;
+    return std::filesystem::last_write_time(path, ec);
+  }
+
+  std::vector<std::pair<std::string, std::filesystem::file_time_type>> m_files;
+};
+
+#endif
+
+shader_registry::shader_registry()
+  : watcher_(std::make_unique<watcher>())
+{
+}
+
+shader_registry::~shader_registry()
+{
+  for (auto& e : entries_) {
+    e.job.reset();
+    gl_state::current().forget_program(e.program);
+    glDeleteProgram(e.program);
+  }
+}
+
+auto
+shader_registry::add(const std::string& vert_path,
+                     const std::string& frag_path,
+                     const defines& defs,
+                     const shader_version version) -> handle
+{
+  entry e;
+  e.vert_path = vert_path;
+  e.frag_path = frag_path;
+  e.defs = defs;
+  e.version = version;
+
+  watcher_->add(vert_path);
+  watcher_->add(frag_path);
+
+  start(e);
+
+  if (e.job) {
+    complete(e);
+  }
+
+  entries_.emplace_back(std::move(e));
+
+  return entries_.size() - 1;
+}
+
+auto
+shader_registry::program(const handle h) const -> GLuint
+{
+  return entries_.at(h).program;
+}
+
+auto
+shader_registry::generation(const handle h) const -> std::uint64_t
+{
+  return entries_.at(h).generation;
+}
+
+auto
+shader_registry::error(const handle h) const -> const std::string&
+{
+  return entries_.at(h).error;
+}
+
+auto
+shader_registry::has_errors() const -> bool
+{
+  return std::any_of(entries_.begin(), entries_.end(), [](const entry& e) { return !e.error.empty(); });
+}
+
+void
+shader_registry::reload(const handle h)
+{
+  entries_.at(h).dirty = true;
+}
+
+void
+shader_registry::poll(const std::size_t max_pending)
+{
+  watcher_->poll([this](const std::string& path) {
+    for (auto& e : entries_) {
+      if ((e.vert_path == path) || (e.frag_path == path)) {
+        e.dirty = true;
+      }
+    }
+  });
+
+  std::size_t pending{ 0 };
+
+  for (auto& e : entries_) {
+
+    if (!e.job) {
+      continue;
+    }
+
+    if (e.job->poll()) {
+      complete(e);
+    } else {
+      pending++;
+    }
+  }
+
+  for (auto& e : entries_) {
+
+    if (pending >= max_pending) {
+      break;
+    }
+
+    // A program that changes again while it is compiling is restarted once the current job completes.
+
+    if (e.dirty && !e.job) {
+      start(e);
+      pending += e.job ? 1 : 0;
+    }
+  }
+}
+
+void
+shader_registry::start(entry& e)
+{
+  e.dirty = false;
+
+  std::string vert_source;
+  std::string frag_source;
+
+  if (!read_file(e.vert_path, vert_source)) {
+    e.error = "Failed to open '" + e.vert_path + "'.";
+    return;
+  }
+
+  if (!read_file(e.frag_path, frag_source)) {
+    e.error = "Failed to open '" + e.frag_path + "'.";
+    return;
+  }
+
+  auto job = compile_shader_async(vert_source.c_str(), frag_source.c_str(), e.defs, e.version);
+
+  e.job = std::make_unique<shader_job>(std::move(job));
+}
+
+void
+shader_registry::complete(entry& e)
+{
+  auto job = std::move(e.job);
+
+  try {
+
+    const auto program = job->get();
+
+    gl_state::current().forget_program(e.program);
+    glDeleteProgram(e.program);
+
+    e.program = program;
+
+    e.generation++;
+
+    e.error.clear();
+
+  } catch (const shader_error& err) {
+    e.error = std::string(err.what());
+  }
+}
+
+void
+shader_registry::render_overlay()
+{
+  if (!has_errors()) {
+    return;
+  }
+
+  const auto& io = ImGui::GetIO();
+
+  const ImVec2 center(io.DisplaySize.x * 0.5f, io.DisplaySize.y * 0.5f);
+
+  ImGui::SetNextWindowPos(center, ImGuiCond_Always, ImVec2(0.5f, 0.5f));
+
+  ImGui::SetNextWindowBgAlpha(0.9f);
+
+  if (ImGui::Begin("Shader Errors", nullptr, ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoCollapse)) {
+
+    for (const auto& e : entries_) {
+
+      if (e.error.empty()) {
+        continue;
+      }
+
+      ImGui::PushID(&e);
+
+      ImGui::Text("%s, %s", e.vert_path.c_str(), e.frag_path.c_str());
+
+      ImGui::TextUnformatted(e.error.c_str());
+
+      ImGui::Separator();
+
+      ImGui::PopID();
+    }
+  }
+
+  ImGui::End();
+}
+
+} // namespace glow
@@ -0,0 +1,138 @@
+#include <glow/shader_variants.hpp>
+
+#include <glow/gl_state.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+
+namespace glow {
+
+shader_variant_cache::shader_variant_cache(std::string vert_source, std::string frag_source, shader_version version)
+  : vert_source_(std::move(vert_source))
+  , frag_source_(std::move(frag_source))
+  , version_(version)
+{
+}
+
+shader_variant_cache::~shader_variant_cache()
+{
+  clear();
+}
+
+auto
+shader_variant_cache::find(const std::uint64_t key) -> GLuint
+{
+  auto it = variants_.find(key);
+  if (it == variants_.end()) {
+    return 0;
+  }
+
+  it->second.last_used_frame = frame_;
+
+  return it->second.program;
+}
+
+auto
+shader_variant_cache::insert(const std::uint64_t key, const defines& defs) -> GLuint
+{
+  auto existing = find(key);
+  if (existing != 0) {
+    return existing;
+  }
+
+  const auto t0 = std::chrono::steady_clock::now();
+
+  const auto program = compile_shader(vert_source_.c_str(), frag_source_.c_str(), defs, version_);
+
+  const auto t1 = std::chrono::steady_clock::now();
+
+  const auto ms = std::chrono::duration<double, std::milli>(t1 - t0).count();
+
+  stats_.compile_count++;
+  stats_.total_compile_ms += ms;
+  stats_.max_compile_ms = std::max(stats_.max_compile_ms, ms);
+
+  // The least recently used variant is only evicted once the new one has compiled, so that a failed compile does not
+  // cost a working variant. Variants used in the current frame may still be bound, so the cache grows past its
+  // capacity rather than evicting one of them.
+  while ((capacity_ > 0) && (variants_.size() >= capacity_)) {
+    auto lru = variants_.end();
+    for (auto it = variants_.begin(); it != variants_.end(); ++it) {
+      if ((it->second.last_used_frame != frame_) &&
+          ((lru == variants_.end()) || (it->second.last_used_frame < lru->second.last_used_frame))) {
+        lru = it;
+      }
+    }
+    if (lru == variants_.end()) {
+      break;
+    }
+    evict(lru);
+  }
+
+  variant v;
+  v.program = program;
+  v.last_used_frame = frame_;
+  variants_.emplace(key, v);
+
+  stats_.resident_count = variants_.size();
+
+  return program;
+}
+
+void
+shader_variant_cache::next_frame()
+{
+  frame_++;
+}
+
+void
+shader_variant_cache::evict_unused(const std::uint32_t max_idle_frames)
+{
+  for (auto it = variants_.begin(); it != variants_.end();) {
+    auto next = std::next(it);
+    if ((frame_ - it->second.last_used_frame) > max_idle_frames) {
+      evict(it);
+    }
+    it = next;
+  }
+}
+
+void
+shader_variant_cache::set_capacity(const std::size_t capacity)
+{
+  capacity_ = capacity;
+}
+
+void
+shader_variant_cache::clear()
+{
+  for (auto& v : variants_) {
+    gl_state::current().forget_program(v.second.program);
+    glDeleteProgram(v.second.program);
+  }
+
+  variants_.clear();
+
+  stats_.resident_count = 0;
+}
+
+auto
+shader_variant_cache::stats() const -> const shader_variant_stats&
+{
+  return stats_;
+}
+
+void
+shader_variant_cache::evict(const std::unordered_map<std::uint64_t, variant>::iterator it)
+{
+  gl_state::current().forget_program(it->second.program);
+  glDeleteProgram(it->second.program);
+
+  variants_.erase(it);
+
+  stats_.eviction_count++;
+  stats_.resident_count = variants_.size();
+}
+
+} // namespace glow
@@ -0,0 +1,284 @@
+#include <glow/shader_warmup.hpp>
+
+#include <glow/gl_state.hpp>
+
+#include <imgui.h>
+
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+namespace glow {
+
+namespace {
+
+auto
+read_file(const std::string& path) -> std::string
+{
+  std::ifstream file(path, std::ios::binary);
+  if (!file.good()) {
+    throw std::runtime_error("Failed to open '" + path + "'.");
+  }
+
+  std::ostringstream stream;
+  stream << file.rdbuf();
+  return stream.str();
+}
+
+auto
+directory_of(const std::string& path) -> std::string
+{
+  const auto pos = path.find_last_of("/\\");
+  return (pos == std::string::npos) ? std::string(".") : path.substr(0, pos);
+}
+
+} // namespace
+
+shader_warmup::shader_warmup() = default;
+
+shader_warmup::~shader_warmup()
+{
+  for (auto& e : entries_) {
+    e.job.reset();
+    gl_state::current().forget_program(e.program);
+    glDeleteProgram(e.program);
+  }
+}
+
+void
+shader_warmup::load_manifest(const std::string& path)
+{
+  const auto dir = directory_of(path);
+
+  std::istringstream manifest(read_file(path));
+
+  std::string line;
+
+  std::size_t line_number{ 0 };
+
+  while (std::getline(manifest, line)) {
+
+    line_number++;
+
+    std::istringstream tokens(line);
+
+    std::string keyword;
+
+    if (!(tokens >> keyword) || (keyword[0] == '#')) {
+      continue;
+    }
+
+    std::string name;
+    std::string vert_path;
+    std::string frag_path;
+
+    if ((keyword != "program") || !(tokens >> name >> vert_path >> frag_path)) {
+      std::ostringstream error;
+      error << path << ':' << line_number << ": expected 'program <name> <vertex shader> <fragment shader>'";
+      throw std::runtime_error(error.str());
+    }
+
+    auto version = shader_version::es_100;
+
+    defines defs;
+
+    std::string option;
+
+    while (tokens >> option) {
+
+      if (option == "es300") {
+        version = shader_version::es_300;
+        continue;
+      }
+
+      const auto eq = option.find('=');
+      if (eq == std::string::npos) {
+        defs.emplace_back(option, "1");
+      } else {
+        defs.emplace_back(option.substr(0, eq), option.substr(eq + 1));
+      }
+    }
+
+    add(name, read_file(dir + "/" + vert_path), read_file(dir + "/" + frag_path), defs, version);
+  }
+}
+
+void
+shader_warmup::add(const std::string& name,
+                   std::string vert_source,
+                   std::string frag_source,
+                   const defines& defs,
+                   const shader_version version)
+{
+  entry e;
+  e.name = name;
+  e.vert_source = std::move(vert_source);
+  e.frag_source = std::move(frag_source);
+  e.defs = defs;
+  e.version = version;
+
+  names_[name] = entries_.size();
+
+  entries_.emplace_back(std::move(e));
+}
+
+auto
+shader_warmup::step(const float budget_ms) -> bool
+{
+  using clock = std::chrono::steady_clock;
+
+  const auto deadline = clock::now() + std::chrono::duration<float, std::milli>(budget_ms);
+
+  // Jobs are started until the budget runs out, so the driver can work on several of them at once. Those that
+  // completed in the meantime are finished on the way.
+
+  bool finished_any{ false };
+
+  do {
+
+    if (next_ < entries_.size()) {
+      start(entries_[next_]);
+      next_++;
+    }
+
+    // Finishing a program waits for its link status and draws with it, so the budget is checked before each one and
+    // the rest are left for the next frame. One is always finished, so that a small budget still makes progress.
+    for (auto& e : entries_) {
+      if (finished_any && (clock::now() >= deadline)) {
+        break;
+      }
+      if (e.job && e.job->poll()) {
+        finish(e);
+        finished_any = true;
+      }
+    }
+
+  } while ((next_ < entries_.size()) && (clock::now() < deadline));
+
+  return done();
+}
+
+auto
+shader_warmup::done() const -> bool
+{
+  return done_count_ == entries_.size();
+}
+
+auto
+shader_warmup::progress() const -> float
+{
+  if (entries_.empty()) {
+    return 1.0f;
+  }
+
+  return static_cast<float>(done_count_) / static_cast<float>(entries_.size());
+}
+
+auto
+shader_warmup::program(const std::string& name) const -> GLuint
+{
+  auto it = names_.find(name);
+
+  return (it == names_.end()) ? 0 : entries_[it->second].program;
+}
+
+auto
+shader_warmup::errors() const -> std::vector<std::pair<std::string, std::string>>
+{
+  std::vector<std::pair<std::string, std::string>> result;
+
+  for (const auto& e : entries_) {
+    if (!e.error.empty()) {
+      result.emplace_back(e.name, e.error);
+    }
+  }
+
+  return result;
+}
+
+void
+shader_warmup::render_progress()
+{
+  const auto& io = ImGui::GetIO();
+
+  const ImVec2 center(io.DisplaySize.x * 0.5f, io.DisplaySize.y * 0.5f);
+
+  ImGui::SetNextWindowPos(center, ImGuiCond_Always, ImVec2(0.5f, 0.5f));
+
+  ImGui::SetNextWindowSize(ImVec2(io.DisplaySize.x * 0.5f, 0), ImGuiCond_Always);
+
+  const auto flags = ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoSavedSettings;
+
+  if (ImGui::Begin("##shader_warmup", nullptr, flags)) {
+
+    ImGui::TextUnformatted("Compiling shaders...");
+
+    ImGui::ProgressBar(progress());
+  }
+
+  ImGui::End();
+}
+
+void
+shader_warmup::start(entry& e)
+{
+  auto job = compile_shader_async(e.vert_source.c_str(), e.frag_source.c_str(), e.defs, e.version);
+
+  e.job = std::make_unique<shader_job>(std::move(job));
+}
+
+void
+shader_warmup::finish(entry& e)
+{
+  auto job = std::move(e.job);
+
+  try {
+    e.program = job->get();
+    draw_once(e.program);
+  } catch (const shader_error& err) {
+    e.error = err.what();
+  }
+
+  e.done = true;
+
+  e.vert_source.clear();
+  e.frag_source.clear();
+
+  done_count_++;
+}
+
+void
+shader_warmup::draw_once(const GLuint program)
+{
+  if (!target_) {
+    target_ = std::make_unique<framebuffer>(1, 1);
+    quad_ = std::make_unique<screen_quad>();
+  }
+
+  auto& state = gl_state::current();
+
+  const auto previous_fb = state.draw_framebuffer();
+
+  GLint previous_viewport[4]{};
+
+  glGetIntegerv(GL_VIEWPORT, previous_viewport);
+
+  target_->bind();
+
+  state.viewport(0, 0, 1, 1);
+
+  state.use_program(program);
+
+  quad_->draw_triangle();
+
+  state.use_program(0);
+
+  state.bind_vertex_array(0);
+
+  state.bind_framebuffer(GL_FRAMEBUFFER, previous_fb);
+
+  state.viewport(previous_viewport[0], previous_viewport[1], previous_viewport[2], previous_viewport[3]);
+}
+
+} // namespace glow
@@ -0,0 +1,154 @@
+#include <glow/task_pool.hpp>
+
+#include <utility>
+
+namespace glow {
+
+task_pool::task_pool(std::size_t threads)
+{
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+  threads = 0;
+#else
+  if (threads == 0) {
+    const auto hardware_threads = static_cast<std::size_t>(std::thread::hardware_concurrency());
+    threads = (hardware_threads > 1) ? (hardware_threads - 1) : 0;
+  }
+#endif
+
+  threads_.reserve(threads);
+
+  for (std::size_t i = 0; i < threads; i++) {
+    threads_.emplace_back([this] { work(); });
+  }
+}
+
+task_pool::~task_pool()
+{
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_signal_.wait(lock, [this] { return active_ == 0; });
+    stopping_ = true;
+  }
+
+  start_signal_.notify_all();
+
+  for (auto& t : threads_) {
+    t.join();
+  }
+}
+
+void
+task_pool::start(const std::size_t count, task func)
+{
+  if (busy_) {
+    wait();
+  }
+
+  {
+    // Workers that were late to join the last batch may still be reading it, so it is only replaced once they left.
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_signal_.wait(lock, [this] { return active_ == 0; });
+    func_ = std::move(func);
+    count_ = count;
+    next_.store(0);
+    error_ = nullptr;
+    generation_++;
+    busy_ = true;
+  }
+
+  start_signal_.notify_all();
+}
+
+void
+task_pool::wait()
+{
+  if (!busy_) {
+    return;
+  }
+
+  run_tasks();
+
+  std::exception_ptr error;
+
+  {
+    // Every task has been taken by now, so the batch is done once the workers that took them have left.
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_signal_.wait(lock, [this] { return active_ == 0; });
+    busy_ = false;
+    error = std::exchange(error_, nullptr);
+  }
+
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+void
+task_pool::run(const std::size_t count, task func)
+{
+  start(count, std::move(func));
+  wait();
+}
+
+auto
+task_pool::busy() const -> bool
+{
+  return busy_;
+}
+
+auto
+task_pool::thread_count() const -> std::size_t
+{
+  return threads_.size();
+}
+
+void
+task_pool::work()
+{
+  std::uint64_t generation{ 0 };
+
+  while (true) {
+
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      start_signal_.wait(lock, [&] { return stopping_ || (generation_ != generation); });
+      if (stopping_) {
+        return;
+      }
+      generation = generation_;
+      active_++;
+    }
+
+    run_tasks();
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      active_--;
+    }
+
+    done_signal_.notify_all();
+  }
+}
+
+void
+task_pool::run_tasks()
+{
+  while (true) {
+
+    const auto index = next_.fetch_add(1);
+    if (index >= count_) {
+      break;
+    }
+
+    try {
+      func_(index);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!error_) {
+        error_ = std::current_exception();
+      }
+    }
+  }
+}
+
+} // namespace glow
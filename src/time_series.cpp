@@ -0,0 +1,334 @@
+#include <glow/time_series.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+#include <cstddef>
+
+namespace glow {
+
+namespace {
+
+constexpr auto infinity = std::numeric_limits<double>::infinity();
+
+constexpr auto nan = std::numeric_limits<double>::quiet_NaN();
+
+/// @brief The finest level kept in the pyramid. Its entries each cover 8 samples, since below that it is about as fast
+///        to read the samples themselves, and the finer levels would take more memory than the samples do.
+constexpr std::size_t finest_level{ 3 };
+
+/// @brief Gets the index of the first entry of a level in a channel's pyramid.
+auto
+level_offset(const std::size_t chunk_size, const std::size_t level) -> std::size_t
+{
+  return (chunk_size >> (finest_level - 1)) - (chunk_size >> (level - 1));
+}
+
+/// @brief Gets the number of entries in a channel's pyramid.
+auto
+pyramid_size(const std::size_t chunk_size) -> std::size_t
+{
+  return (chunk_size >> (finest_level - 1)) - 1;
+}
+
+/// @brief Finds the first index in [first, last) for which the predicate is false.
+template<typename Predicate>
+auto
+partition_point(std::size_t first, std::size_t last, Predicate pred) -> std::size_t
+{
+  while (first < last) {
+    const auto middle = first + (last - first) / 2;
+    if (pred(middle)) {
+      first = middle + 1;
+    } else {
+      last = middle;
+    }
+  }
+  return first;
+}
+
+} // namespace
+
+time_series::time_series(const std::size_t channels, const std::size_t chunk_size)
+  : channels_(channels)
+  , chunk_size_(chunk_size)
+{
+  if (channels == 0) {
+    throw std::invalid_argument("A time series needs at least one channel.");
+  }
+
+  if ((chunk_size < (std::size_t{ 1 } << finest_level)) || ((chunk_size & (chunk_size - 1)) != 0)) {
+    throw std::invalid_argument("The chunk size of a time series must be a power of two, and at least 8.");
+  }
+
+  while ((std::size_t{ 1 } << level_count_) < chunk_size) {
+    level_count_++;
+  }
+}
+
+void
+time_series::append(const double time, const double* values)
+{
+  append(&time, values, 1);
+}
+
+void
+time_series::append(const double* times, const double* values, const std::size_t count)
+{
+  auto previous = chunks_.empty() ? -infinity : time_at(size() - 1);
+
+  for (std::size_t i = 0; i < count; i++) {
+    if (!(times[i] >= previous)) {
+      throw std::invalid_argument("The times of a time series must not decrease.");
+    }
+    previous = times[i];
+  }
+
+  std::size_t i{ 0 };
+
+  while (i < count) {
+
+    if (chunks_.empty() || (chunks_.back().size == chunk_size_)) {
+      chunk c;
+      c.times.resize(chunk_size_);
+      c.values.resize(chunk_size_ * channels_);
+      c.levels.resize(pyramid_size(chunk_size_) * channels_);
+      chunks_.emplace_back(std::move(c));
+    }
+
+    auto& c = chunks_.back();
+
+    const auto first = c.size;
+    const auto run = std::min(count - i, chunk_size_ - first);
+
+    std::copy(times + i, times + i + run, c.times.begin() + static_cast<std::ptrdiff_t>(first));
+
+    for (std::size_t ch = 0; ch < channels_; ch++) {
+      auto* column = c.values.data() + ch * chunk_size_;
+      for (std::size_t j = 0; j < run; j++) {
+        column[first + j] = values[(i + j) * channels_ + ch];
+      }
+    }
+
+    c.size += run;
+
+    for (std::size_t ch = 0; ch < channels_; ch++) {
+      update_pyramid(c, ch, first);
+    }
+
+    i += run;
+  }
+}
+
+void
+time_series::update_pyramid(chunk& c, const std::size_t channel, const std::size_t first) const
+{
+  const auto* column = c.values.data() + channel * chunk_size_;
+
+  auto* pyramid = c.levels.data() + channel * pyramid_size(chunk_size_);
+
+  // Each entry that covers a new sample is rebuilt from the level below it, which costs about two comparisons per
+  // sample regardless of the number of levels. NaN fails both comparisons, so it never becomes an extreme.
+  auto merge = [](range& r, const double min, const double max) {
+    r.min = (min < r.min) ? min : r.min;
+    r.max = (max > r.max) ? max : r.max;
+  };
+
+  for (auto j = first >> finest_level; (j << finest_level) < c.size; j++) {
+    range r{ infinity, -infinity };
+    for (auto i = j << finest_level; i < std::min((j + 1) << finest_level, c.size); i++) {
+      merge(r, column[i], column[i]);
+    }
+    pyramid[j] = r;
+  }
+
+  for (auto k = finest_level + 1; k <= level_count_; k++) {
+
+    auto* level = pyramid + level_offset(chunk_size_, k);
+
+    const auto* below = pyramid + level_offset(chunk_size_, k - 1);
+
+    const auto below_size = (c.size + (std::size_t{ 1 } << (k - 1)) - 1) >> (k - 1);
+
+    for (auto j = first >> k; (j << k) < c.size; j++) {
+      range r{ infinity, -infinity };
+      for (auto child = 2 * j; child < std::min(2 * j + 2, below_size); child++) {
+        merge(r, below[child].min, below[child].max);
+      }
+      level[j] = r;
+    }
+  }
+}
+
+void
+time_series::discard_before(const double time)
+{
+  // The last chunk is kept, so that appending can continue from it.
+  while ((chunks_.size() > 1) && (chunks_.front().times[chunk_size_ - 1] < time)) {
+    chunks_.pop_front();
+  }
+}
+
+void
+time_series::clear()
+{
+  chunks_.clear();
+}
+
+void
+time_series::plot_line(const char* label, const std::size_t channel, const ImPlotLineFlags flags)
+{
+  build_groups(channel);
+
+  xs_.clear();
+  ys_.clear();
+
+  for (std::size_t i = 0; i < group_starts_.size(); i++) {
+    xs_.push_back(group_starts_[i]);
+    ys_.push_back(group_mins_[i]);
+    if (group_maxs_[i] != group_mins_[i]) {
+      xs_.push_back(group_ends_[i]);
+      ys_.push_back(group_maxs_[i]);
+    }
+  }
+
+  ImPlot::PlotLine(label, xs_.data(), ys_.data(), static_cast<int>(xs_.size()), flags);
+}
+
+void
+time_series::plot_envelope(const char* label, const std::size_t channel, const ImPlotShadedFlags flags)
+{
+  build_groups(channel);
+
+  ImPlot::PlotShaded(label,
+                     group_starts_.data(),
+                     group_mins_.data(),
+                     group_maxs_.data(),
+                     static_cast<int>(group_starts_.size()),
+                     flags);
+}
+
+auto
+time_series::time_range() const -> std::pair<double, double>
+{
+  if (chunks_.empty()) {
+    return { 0.0, 0.0 };
+  }
+
+  return { time_at(0), time_at(size() - 1) };
+}
+
+auto
+time_series::size() const -> std::size_t
+{
+  // Every chunk but the last is full.
+  return chunks_.empty() ? 0 : ((chunks_.size() - 1) * chunk_size_ + chunks_.back().size);
+}
+
+auto
+time_series::channels() const -> std::size_t
+{
+  return channels_;
+}
+
+auto
+time_series::chunk_size() const -> std::size_t
+{
+  return chunk_size_;
+}
+
+auto
+time_series::time_at(const std::size_t index) const -> double
+{
+  return chunks_[index / chunk_size_].times[index % chunk_size_];
+}
+
+auto
+time_series::entry(const std::size_t channel, const std::size_t level, const std::size_t index) const -> range
+{
+  const auto entries_per_chunk = chunk_size_ >> level;
+
+  const auto& c = chunks_[index / entries_per_chunk];
+
+  const auto i = index % entries_per_chunk;
+
+  if (level == 0) {
+    const auto v = c.values[channel * chunk_size_ + i];
+    return { v, v };
+  }
+
+  return c.levels[channel * pyramid_size(chunk_size_) + level_offset(chunk_size_, level) + i];
+}
+
+void
+time_series::build_groups(const std::size_t channel)
+{
+  if (channel >= channels_) {
+    throw std::out_of_range("Time series channel index is out of range.");
+  }
+
+  group_starts_.clear();
+  group_ends_.clear();
+  group_mins_.clear();
+  group_maxs_.clear();
+
+  const auto n = size();
+  if (n == 0) {
+    return;
+  }
+
+  const auto limits = ImPlot::GetPlotLimits();
+  const auto width = std::max(static_cast<double>(ImPlot::GetPlotSize().x), 1.0);
+
+  auto first = partition_point(0, n, [&](const std::size_t i) { return time_at(i) < limits.X.Min; });
+  auto last = partition_point(first, n, [&](const std::size_t i) { return time_at(i) <= limits.X.Max; });
+
+  // Include the samples just outside of the view, so that the line reaches its edges.
+  first = (first > 0) ? (first - 1) : first;
+  last = (last < n) ? (last + 1) : last;
+
+  if (first >= last) {
+    return;
+  }
+
+  const auto samples_per_pixel = static_cast<double>(last - first) / width;
+
+  std::size_t level{ 0 };
+  while ((level < level_count_) && (static_cast<double>(std::size_t{ 2 } << level) <= samples_per_pixel)) {
+    level++;
+  }
+
+  // The levels finer than the pyramid keeps are read from the samples, a few at a time.
+  level = (level < finest_level) ? 0 : level;
+
+  // Past the top of the pyramid, consecutive chunk summaries are merged to keep to about one group per pixel.
+  const auto group_size =
+    std::max(static_cast<std::size_t>(samples_per_pixel / static_cast<double>(std::size_t{ 1 } << level)),
+             std::size_t{ 1 });
+
+  const auto first_entry = first >> level;
+  const auto last_entry = ((last - 1) >> level) + 1;
+
+  for (auto e = first_entry; e < last_entry; e += group_size) {
+
+    const auto end_entry = std::min(e + group_size, last_entry);
+
+    range r{ infinity, -infinity };
+
+    for (auto i = e; i < end_entry; i++) {
+      const auto x = entry(channel, level, i);
+      r.min = (x.min < r.min) ? x.min : r.min;
+      r.max = (x.max > r.max) ? x.max : r.max;
+    }
+
+    const auto is_gap = r.min > r.max;
+
+    group_starts_.push_back(time_at(e << level));
+    group_ends_.push_back(time_at(std::min(end_entry << level, n) - 1));
+    group_mins_.push_back(is_gap ? nan : r.min);
+    group_maxs_.push_back(is_gap ? nan : r.max);
+  }
+}
+
+} // namespace glow
@@ -0,0 +1,144 @@
+#include <glow/uniform_ring.hpp>
+
+#include <glow/gl_state.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <cstring>
+
+namespace glow {
+
+uniform_ring::uniform_ring(const std::size_t frame_size, const std::size_t frames_in_flight)
+  : frames_(std::max(frames_in_flight, static_cast<std::size_t>(1)))
+  , staging_(frame_size)
+  , current_(frames_.size() - 1)
+{
+  GLint alignment{ 0 };
+
+  glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+
+  if (alignment > 0) {
+    alignment_ = static_cast<std::size_t>(alignment);
+  }
+
+  for (auto& f : frames_) {
+    glGenBuffers(1, &f.buffer);
+    gl_state::current().bind_buffer(GL_UNIFORM_BUFFER, f.buffer);
+    glBufferData(GL_UNIFORM_BUFFER, static_cast<GLsizeiptr>(frame_size), nullptr, GL_DYNAMIC_DRAW);
+  }
+
+  gl_state::current().bind_buffer(GL_UNIFORM_BUFFER, 0);
+}
+
+uniform_ring::~uniform_ring()
+{
+  for (auto& f : frames_) {
+    if (f.fence) {
+      glDeleteSync(f.fence);
+    }
+    gl_state::current().forget_buffer(f.buffer);
+    glDeleteBuffers(1, &f.buffer);
+  }
+}
+
+void
+uniform_ring::begin_frame()
+{
+  current_ = (current_ + 1) % frames_.size();
+
+  offset_ = 0;
+
+  uploaded_ = 0;
+
+  auto& f = frames_[current_];
+
+  if (!f.fence) {
+    return;
+  }
+
+  constexpr GLuint64 timeout_ns{ 1000000 };
+
+  GLbitfield flags{ GL_SYNC_FLUSH_COMMANDS_BIT };
+
+  for (;;) {
+    const auto result = glClientWaitSync(f.fence, flags, timeout_ns);
+    if ((result == GL_ALREADY_SIGNALED) || (result == GL_CONDITION_SATISFIED) || (result == GL_WAIT_FAILED)) {
+      break;
+    }
+    flags = 0;
+  }
+
+  glDeleteSync(f.fence);
+
+  f.fence = nullptr;
+}
+
+auto
+uniform_ring::push(const void* data, const std::size_t size) -> uniform_allocation
+{
+  const auto offset = ((offset_ + alignment_ - 1) / alignment_) * alignment_;
+
+  if ((offset + size) > staging_.size()) {
+    throw std::length_error("Uniform ring is out of space for this frame.");
+  }
+
+  std::memcpy(staging_.data() + offset, data, size);
+
+  offset_ = offset + size;
+
+  return uniform_allocation{ offset, size };
+}
+
+void
+uniform_ring::upload()
+{
+  if (offset_ <= uploaded_) {
+    return;
+  }
+
+  gl_state::current().bind_buffer(GL_UNIFORM_BUFFER, frames_[current_].buffer);
+
+  glBufferSubData(GL_UNIFORM_BUFFER,
+                  static_cast<GLintptr>(uploaded_),
+                  static_cast<GLsizeiptr>(offset_ - uploaded_),
+                  staging_.data() + uploaded_);
+
+  uploaded_ = offset_;
+}
+
+void
+uniform_ring::bind(const GLuint binding, const uniform_allocation& allocation)
+{
+  gl_state::current().bind_buffer_range(GL_UNIFORM_BUFFER,
+                                       binding,
+                                       frames_[current_].buffer,
+                                       static_cast<GLintptr>(allocation.offset),
+                                       static_cast<GLsizeiptr>(allocation.size));
+}
+
+void
+uniform_ring::end_frame()
+{
+  auto& f = frames_[current_];
+
+  if (f.fence) {
+    glDeleteSync(f.fence);
+  }
+
+  f.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+auto
+uniform_ring::used() const -> std::size_t
+{
+  return offset_;
+}
+
+auto
+uniform_ring::capacity() const -> std::size_t
+{
+  return staging_.size();
+}
+
+} // namespace glow